@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <stack>
+#include <string>
+#include <utility>
+
+#include "bench_values.h"
+#include "my_queue.h"
+#include "my_stack.h"
+
+// Queue and Stack against std::queue and std::stack, each with its default
+// container, for every element type in bench_values.h.
+
+template <class T, class... Args>
+static void InsertMany(mynamespace::Queue<T> &queue, Args &&...args) {
+  queue.insert_many_back(std::forward<Args>(args)...);
+}
+
+template <class T, class... Args>
+static void InsertMany(mynamespace::Stack<T> &stack, Args &&...args) {
+  stack.insert_many_front(std::forward<Args>(args)...);
+}
+
+template <class Adapter, class... Args>
+static void InsertMany(Adapter &adapter, Args &&...args) {
+  (adapter.emplace(std::forward<Args>(args)), ...);
+}
+
+template <class T>
+static const T &Peek(const mynamespace::Queue<T> &queue) {
+  return queue.front();
+}
+
+template <class T>
+static const T &Peek(const std::queue<T> &queue) {
+  return queue.front();
+}
+
+template <class T>
+static const T &Peek(const mynamespace::Stack<T> &stack) {
+  return stack.top();
+}
+
+template <class T>
+static const T &Peek(const std::stack<T> &stack) {
+  return stack.top();
+}
+
+// Fill to the given depth, then empty again.
+template <class Adapter>
+static void BM_AdapterPushPop(benchmark::State &state) {
+  using value_type = typename Adapter::value_type;
+  value_type value = MakeValue<value_type>(1);
+  Adapter adapter;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) adapter.push(value);
+    int64_t sum = 0;
+    while (!adapter.empty()) {
+      sum += Weight(Peek(adapter));
+      adapter.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Steady traffic at a fixed depth.
+template <class Adapter>
+static void BM_AdapterSteady(benchmark::State &state) {
+  using value_type = typename Adapter::value_type;
+  value_type value = MakeValue<value_type>(1);
+  Adapter adapter;
+  for (int64_t i = 0; i < state.range(0); ++i) adapter.push(value);
+  for (auto _ : state) {
+    adapter.push(value);
+    benchmark::DoNotOptimize(Weight(Peek(adapter)));
+    adapter.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <class Adapter>
+static void BM_AdapterInsertMany(benchmark::State &state) {
+  using value_type = typename Adapter::value_type;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    Adapter adapter;
+    for (int64_t i = 0; i < state.range(0); i += 8) {
+      InsertMany(adapter, value, value, value, value, value, value, value,
+                 value);
+    }
+    benchmark::DoNotOptimize(adapter);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define ADAPTER_BENCHMARK_FOR(fn, T)                                    \
+  BENCHMARK_TEMPLATE(fn, mynamespace::Queue<T>)->Arg(1 << 10)->Arg(1 << 16); \
+  BENCHMARK_TEMPLATE(fn, std::queue<T>)->Arg(1 << 10)->Arg(1 << 16);         \
+  BENCHMARK_TEMPLATE(fn, mynamespace::Stack<T>)->Arg(1 << 10)->Arg(1 << 16); \
+  BENCHMARK_TEMPLATE(fn, std::stack<T>)->Arg(1 << 10)->Arg(1 << 16)
+
+#define ADAPTER_BENCHMARK(fn)       \
+  ADAPTER_BENCHMARK_FOR(fn, int);   \
+  ADAPTER_BENCHMARK_FOR(fn, Pod64); \
+  ADAPTER_BENCHMARK_FOR(fn, std::string)
+
+ADAPTER_BENCHMARK(BM_AdapterPushPop);
+ADAPTER_BENCHMARK(BM_AdapterSteady);
+ADAPTER_BENCHMARK(BM_AdapterInsertMany);
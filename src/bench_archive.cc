@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "my_archive.h"
+#include "my_queue.h"
+
+// Checkpointing a Queue of 10M uint64_t to disk and reloading it at
+// startup: element by element through binary iostreams, as an archive
+// with save() and load(), and mapped with MappedView, whose cost is the
+// checksum pass or, unverified, a walk over the mapped elements.
+
+using Checkpoint = mynamespace::Queue<uint64_t>;
+
+static const std::string kStreamPath = "/tmp/bench_archive.stream";
+static const std::string kArchivePath = "/tmp/bench_archive.bin";
+
+static Checkpoint MakeQueue(int64_t n) {
+  Checkpoint q;
+  for (int64_t i = 0; i < n; ++i) {
+    q.push(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL);
+  }
+  return q;
+}
+
+static void StreamSave(const Checkpoint &q, const std::string &path) {
+  std::ofstream out(path, std::ios::binary);
+  uint64_t n = q.size();
+  out.write(reinterpret_cast<const char *>(&n), sizeof(n));
+  for (auto it = q.container().cbegin(); it != q.container().cend(); ++it) {
+    out.write(reinterpret_cast<const char *>(&*it), sizeof(*it));
+  }
+}
+
+static void BM_StreamSave(benchmark::State &state) {
+  Checkpoint q = MakeQueue(state.range(0));
+  for (auto _ : state) StreamSave(q, kStreamPath);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ArchiveSave(benchmark::State &state) {
+  Checkpoint q = MakeQueue(state.range(0));
+  for (auto _ : state) q.save(kArchivePath);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_StreamLoad(benchmark::State &state) {
+  StreamSave(MakeQueue(state.range(0)), kStreamPath);
+  for (auto _ : state) {
+    Checkpoint q;
+    std::ifstream in(kStreamPath, std::ios::binary);
+    uint64_t n = 0;
+    in.read(reinterpret_cast<char *>(&n), sizeof(n));
+    for (uint64_t i = 0; i < n; ++i) {
+      uint64_t value;
+      in.read(reinterpret_cast<char *>(&value), sizeof(value));
+      q.push(value);
+    }
+    benchmark::DoNotOptimize(q.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ArchiveLoad(benchmark::State &state) {
+  MakeQueue(state.range(0)).save(kArchivePath);
+  for (auto _ : state) {
+    Checkpoint q;
+    q.load(kArchivePath);
+    benchmark::DoNotOptimize(q.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_MappedViewSum(benchmark::State &state) {
+  MakeQueue(state.range(0)).save(kArchivePath);
+  for (auto _ : state) {
+    mynamespace::archive::MappedView<uint64_t> view(kArchivePath,
+                                                    state.range(1) != 0);
+    uint64_t sum = 0;
+    for (uint64_t x : view) sum += x;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(kStreamPath.c_str());
+  std::remove(kArchivePath.c_str());
+}
+
+constexpr int64_t kElements = 10000000;
+
+BENCHMARK(BM_StreamSave)->Arg(kElements)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArchiveSave)->Arg(kElements)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StreamLoad)->Arg(kElements)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArchiveLoad)->Arg(kElements)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedViewSum)
+    ->Args({kElements, 1})
+    ->Args({kElements, 0})
+    ->Unit(benchmark::kMillisecond);
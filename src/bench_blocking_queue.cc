@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+#include "my_blocking_queue.h"
+
+constexpr int kItems = 1 << 16;
+
+// One producer streams items while the consumer drains them one by one.
+static void BM_SinglePop(benchmark::State &state) {
+  for (auto _ : state) {
+    mynamespace::BlockingQueue<int64_t> queue(state.range(0));
+    std::thread producer([&queue] {
+      for (int i = 0; i < kItems; ++i) queue.push(i);
+      queue.close();
+    });
+    int64_t value;
+    int64_t sum = 0;
+    while (queue.pop_wait(value)) sum += value;
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+// The same stream drained in batches under one lock each.
+static void BM_BatchPop(benchmark::State &state) {
+  std::vector<int64_t> batch(64);
+  for (auto _ : state) {
+    mynamespace::BlockingQueue<int64_t> queue(state.range(0));
+    std::thread producer([&queue] {
+      for (int i = 0; i < kItems; ++i) queue.push(i);
+      queue.close();
+    });
+    int64_t sum = 0;
+    while (size_t n = queue.pop_up_to(batch.begin(), batch.size())) {
+      for (size_t i = 0; i < n; ++i) sum += batch[i];
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+BENCHMARK(BM_SinglePop)->Arg(64)->Arg(1024)->UseRealTime();
+BENCHMARK(BM_BatchPop)->Arg(64)->Arg(1024)->UseRealTime();
+
+// Drain cost alone: the queue is filled before the consumer starts.
+template <bool kBatch>
+static void BM_Drain(benchmark::State &state) {
+  mynamespace::BlockingQueue<int64_t> queue;
+  std::vector<int64_t> batch(64);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int i = 0; i < kItems; ++i) queue.push(i);
+    state.ResumeTiming();
+    int64_t sum = 0;
+    if constexpr (kBatch) {
+      while (size_t n = queue.pop_up_to(batch.begin(), batch.size())) {
+        for (size_t i = 0; i < n; ++i) sum += batch[i];
+        if (queue.empty()) break;
+      }
+    } else {
+      int64_t value;
+      while (queue.try_pop(value)) sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+BENCHMARK_TEMPLATE(BM_Drain, false);
+BENCHMARK_TEMPLATE(BM_Drain, true);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "my_concurrent_stack.h"
+#include "my_stack.h"
+
+// The baseline: a Stack guarded by a mutex.
+template <class T>
+class LockedStack {
+ public:
+  void push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  mynamespace::Stack<T> stack_;
+};
+
+// Every thread pushes and pops on one shared stack, as a free-list would.
+template <class StackType>
+static void BM_Contention(benchmark::State &state) {
+  static StackType stack;
+  int64_t value = state.thread_index();
+  for (auto _ : state) {
+    stack.push(value);
+    benchmark::DoNotOptimize(stack.try_pop(value));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Contention, mynamespace::ConcurrentStack<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention, LockedStack<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Work pool: a batch of items is pushed and then drained by all threads.
+template <class StackType>
+static void BM_WorkPool(benchmark::State &state) {
+  static StackType stack;
+  int64_t value = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < 64; ++i) stack.push(i);
+    while (stack.try_pop(value)) benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK_TEMPLATE(BM_WorkPool, mynamespace::ConcurrentStack<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WorkPool, LockedStack<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+
+#include "my_deque.h"
+#include "my_list.h"
+#include "my_queue.h"
+
+// Sustained FIFO traffic: the queue holds a fixed backlog while items flow
+// through it.
+template <class QueueType>
+static void BM_QueueThroughput(benchmark::State &state) {
+  QueueType queue;
+  for (int64_t i = 0; i < state.range(0); ++i) queue.push(i);
+  int64_t value = 0;
+  for (auto _ : state) {
+    queue.push(value);
+    value += queue.front();
+    queue.pop();
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput,
+                   mynamespace::Queue<int64_t, mynamespace::List<int64_t>>)
+    ->Range(8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueThroughput,
+                   mynamespace::Queue<int64_t, mynamespace::Deque<int64_t>>)
+    ->Range(8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueThroughput, std::queue<int64_t>)
+    ->Range(8, 1 << 20);
+
+// Burst fill and drain.
+template <class QueueType>
+static void BM_QueueBurst(benchmark::State &state) {
+  QueueType queue;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) queue.push(i);
+    while (!queue.empty()) queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_QueueBurst,
+                   mynamespace::Queue<int64_t, mynamespace::List<int64_t>>)
+    ->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueBurst,
+                   mynamespace::Queue<int64_t, mynamespace::Deque<int64_t>>)
+    ->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueBurst, std::queue<int64_t>)->Range(8, 1 << 16);
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench_values.h"
+#include "my_flat_hash_map.h"
+
+// FlatHashMap against std::unordered_map: lookups that hit and miss,
+// inserting into an empty map, and erasing everything by key. Sizes are
+// just under 7/8 of a power of two, so the flat table runs at its highest
+// load factor, about 0.87. Lookups and erases step through the keys in an
+// order unrelated to the insertion order.
+
+static int64_t HighLoad(int log2) { return (int64_t{1} << log2) * 7 / 8 - 1; }
+
+// Keys number first to first + n - 1; Scramble is a bijection, so
+// disjoint numbers give disjoint keys.
+template <class Key>
+static std::vector<Key> MakeKeys(int64_t n, int64_t first) {
+  std::vector<Key> keys;
+  keys.reserve(static_cast<size_t>(n));
+  for (int64_t i = first; i < first + n; ++i) {
+    keys.push_back(MakeValue<Key>(Scramble(static_cast<uint32_t>(i))));
+  }
+  return keys;
+}
+
+template <class Map>
+static void Fill(Map &m, const std::vector<typename Map::key_type> &keys) {
+  for (const auto &key : keys) m.insert({key, 0});
+}
+
+template <class Map>
+static void BM_HashLookupHit(benchmark::State &state) {
+  using Key = typename Map::key_type;
+  std::vector<Key> keys = MakeKeys<Key>(state.range(0), 0);
+  Map m;
+  Fill(m, keys);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(keys[i]));
+    i = (i + 7919) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Misses probe until the first group with an empty slot, which is the
+// longest walk at a high load factor.
+template <class Map>
+static void BM_HashLookupMiss(benchmark::State &state) {
+  using Key = typename Map::key_type;
+  Map m;
+  Fill(m, MakeKeys<Key>(state.range(0), 0));
+  std::vector<Key> misses = MakeKeys<Key>(state.range(0), state.range(0));
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(misses[i]));
+    i = (i + 7919) % misses.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <class Map>
+static void BM_HashInsert(benchmark::State &state) {
+  using Key = typename Map::key_type;
+  std::vector<Key> keys = MakeKeys<Key>(state.range(0), 0);
+  for (auto _ : state) {
+    Map m;
+    Fill(m, keys);
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Map>
+static void BM_HashErase(benchmark::State &state) {
+  using Key = typename Map::key_type;
+  std::vector<Key> keys = MakeKeys<Key>(state.range(0), 0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Map m;
+    Fill(m, keys);
+    state.ResumeTiming();
+    for (size_t i = 0, j = 0; i < keys.size(); ++i) {
+      m.erase(keys[j]);
+      j = (j + 7919) % keys.size();
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define HASH_BENCHMARK(fn, Map)  \
+  BENCHMARK_TEMPLATE(fn, Map)    \
+      ->Arg(HighLoad(10))        \
+      ->Arg(HighLoad(16))        \
+      ->Arg(HighLoad(20))
+
+using IntFlatMap = mynamespace::FlatHashMap<int, int>;
+using StdIntMap = std::unordered_map<int, int>;
+using StringFlatMap = mynamespace::FlatHashMap<std::string, int>;
+using StdStringMap = std::unordered_map<std::string, int>;
+
+HASH_BENCHMARK(BM_HashLookupHit, IntFlatMap);
+HASH_BENCHMARK(BM_HashLookupHit, StdIntMap);
+HASH_BENCHMARK(BM_HashLookupMiss, IntFlatMap);
+HASH_BENCHMARK(BM_HashLookupMiss, StdIntMap);
+HASH_BENCHMARK(BM_HashInsert, IntFlatMap);
+HASH_BENCHMARK(BM_HashInsert, StdIntMap);
+HASH_BENCHMARK(BM_HashErase, IntFlatMap);
+HASH_BENCHMARK(BM_HashErase, StdIntMap);
+HASH_BENCHMARK(BM_HashLookupHit, StringFlatMap);
+HASH_BENCHMARK(BM_HashLookupHit, StdStringMap);
+HASH_BENCHMARK(BM_HashLookupMiss, StringFlatMap);
+HASH_BENCHMARK(BM_HashLookupMiss, StdStringMap);
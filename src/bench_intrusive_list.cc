@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "bench_values.h"
+#include "my_intrusive_list.h"
+#include "my_list.h"
+
+// Pooled objects cycled through a FIFO: IntrusiveList links the objects
+// themselves, List<Pod64> copies each one into a new node and List<Pod64 *>
+// allocates a node per pointer.
+
+namespace {
+
+struct PooledPod {
+  Pod64 value;
+  mynamespace::IntrusiveListHook hook;
+};
+
+using PodList = mynamespace::IntrusiveList<PooledPod, &PooledPod::hook>;
+
+std::vector<PooledPod> MakePool(int64_t n) {
+  std::vector<PooledPod> pool(static_cast<size_t>(n));
+  for (int64_t i = 0; i < n; ++i) {
+    pool[i].value = MakeValue<Pod64>(static_cast<uint32_t>(i));
+  }
+  return pool;
+}
+
+}  // namespace
+
+static void BM_IntrusiveListFifo(benchmark::State &state) {
+  std::vector<PooledPod> pool = MakePool(state.range(0));
+  PodList list;
+  for (auto _ : state) {
+    for (PooledPod &object : pool) list.push_back(object);
+    while (!list.empty()) list.pop_front();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ListCopyFifo(benchmark::State &state) {
+  std::vector<PooledPod> pool = MakePool(state.range(0));
+  mynamespace::List<Pod64> list;
+  for (auto _ : state) {
+    for (PooledPod &object : pool) list.push_back(object.value);
+    while (!list.empty()) list.pop_front();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ListPointerFifo(benchmark::State &state) {
+  std::vector<PooledPod> pool = MakePool(state.range(0));
+  mynamespace::List<Pod64 *> list;
+  for (auto _ : state) {
+    for (PooledPod &object : pool) list.push_back(&object.value);
+    while (!list.empty()) list.pop_front();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Erasing a known object from the middle: O(1) from the reference against
+// a linear search in List.
+static void BM_IntrusiveListEraseObject(benchmark::State &state) {
+  std::vector<PooledPod> pool = MakePool(state.range(0));
+  PodList list;
+  for (PooledPod &object : pool) list.push_back(object);
+  PooledPod &victim = pool[pool.size() / 2];
+  for (auto _ : state) {
+    list.erase(victim);
+    list.push_back(victim);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ListEraseObject(benchmark::State &state) {
+  mynamespace::List<int64_t> list;
+  for (int64_t i = 0; i < state.range(0); ++i) list.push_back(i);
+  int64_t victim = state.range(0) / 2;
+  for (auto _ : state) {
+    auto it = list.begin();
+    while (*it != victim) ++it;
+    list.erase(it);
+    list.push_back(victim);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_IntrusiveListFifo)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_ListCopyFifo)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_ListPointerFifo)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_IntrusiveListEraseObject)->Arg(1 << 10);
+BENCHMARK(BM_ListEraseObject)->Arg(1 << 10);
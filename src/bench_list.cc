@@ -0,0 +1,269 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_values.h"
+#include "my_list.h"
+
+// List against std::list for every element type in bench_values.h. Sizes
+// are element counts; every benchmark reports items per second.
+
+template <class ListType>
+static ListType MakeList(int64_t n, bool random) {
+  using value_type = typename ListType::value_type;
+  ListType list;
+  for (int64_t i = 0; i < n; ++i) {
+    uint32_t seed = static_cast<uint32_t>(i);
+    list.push_back(MakeValue<value_type>(random ? Scramble(seed) : seed));
+  }
+  return list;
+}
+
+template <class T, class... Args>
+static void InsertManyBack(mynamespace::List<T> &list, Args &&...args) {
+  list.insert_many_back(std::forward<Args>(args)...);
+}
+
+template <class T, class... Args>
+static void InsertManyBack(std::list<T> &list, Args &&...args) {
+  (list.emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class T, class... Args>
+static void InsertManyFront(mynamespace::List<T> &list, Args &&...args) {
+  list.insert_many_front(std::forward<Args>(args)...);
+}
+
+template <class T, class... Args>
+static void InsertManyFront(std::list<T> &list, Args &&...args) {
+  auto pos = list.begin();
+  (list.emplace(pos, std::forward<Args>(args)), ...);
+}
+
+template <class ListType>
+static void BM_ListPushBack(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    ListType list;
+    for (int64_t i = 0; i < state.range(0); ++i) list.push_back(value);
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListPushFront(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    ListType list;
+    for (int64_t i = 0; i < state.range(0); ++i) list.push_front(value);
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListPopBothEnds(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = MakeList<ListType>(state.range(0), false);
+    state.ResumeTiming();
+    while (!list.empty()) {
+      list.pop_front();
+      if (!list.empty()) list.pop_back();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListMiddleInsertErase(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  ListType list = MakeList<ListType>(state.range(0), false);
+  auto middle = list.begin();
+  for (int64_t i = 0; i < state.range(0) / 2; ++i) ++middle;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto it = list.insert(middle, value);
+      list.erase(it);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListIterate(benchmark::State &state) {
+  ListType list = MakeList<ListType>(state.range(0), false);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += Weight(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListCopy(benchmark::State &state) {
+  ListType list = MakeList<ListType>(state.range(0), false);
+  for (auto _ : state) {
+    ListType copy(list);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListRangeConstruct(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  std::vector<value_type> source;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    source.push_back(MakeValue<value_type>(static_cast<uint32_t>(i)));
+  }
+  for (auto _ : state) {
+    ListType list(source.begin(), source.end());
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListAssign(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  std::vector<value_type> source;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    source.push_back(MakeValue<value_type>(static_cast<uint32_t>(i)));
+  }
+  ListType list = MakeList<ListType>(state.range(0) / 2, false);
+  for (auto _ : state) {
+    list.assign(source.begin(), source.begin() + state.range(0) / 2);
+    list.assign(source.begin(), source.end());
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListMove(benchmark::State &state) {
+  ListType list = MakeList<ListType>(state.range(0), false);
+  for (auto _ : state) {
+    ListType moved(std::move(list));
+    list = std::move(moved);
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <class ListType>
+static void BM_ListSort(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = MakeList<ListType>(state.range(0), true);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListUnique(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      list.push_back(MakeValue<value_type>(static_cast<uint32_t>(i / 4)));
+    }
+    state.ResumeTiming();
+    list.unique();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListReverse(benchmark::State &state) {
+  ListType list = MakeList<ListType>(state.range(0), false);
+  for (auto _ : state) {
+    list.reverse();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListMerge(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType a;
+    ListType b;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      (i % 2 ? a : b).push_back(MakeValue<value_type>(
+          static_cast<uint32_t>(1000000 + i)));
+    }
+    state.ResumeTiming();
+    a.merge(b);
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListSplice(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType a = MakeList<ListType>(state.range(0) / 2, false);
+    ListType b = MakeList<ListType>(state.range(0) / 2, false);
+    state.ResumeTiming();
+    a.splice(a.cbegin(), b);
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <class ListType>
+static void BM_ListInsertMany(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    ListType list;
+    for (int64_t i = 0; i < state.range(0); i += 8) {
+      InsertManyBack(list, value, value, value, value);
+      InsertManyFront(list, value, value, value, value);
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define LIST_BENCHMARK_FOR(fn, T)                                      \
+  BENCHMARK_TEMPLATE(fn, mynamespace::List<T>)->Arg(1 << 10)->Arg(1 << 16); \
+  BENCHMARK_TEMPLATE(fn, std::list<T>)->Arg(1 << 10)->Arg(1 << 16)
+
+#define LIST_BENCHMARK(fn)       \
+  LIST_BENCHMARK_FOR(fn, int);   \
+  LIST_BENCHMARK_FOR(fn, Pod64); \
+  LIST_BENCHMARK_FOR(fn, std::string)
+
+LIST_BENCHMARK(BM_ListPushBack);
+LIST_BENCHMARK(BM_ListPushFront);
+LIST_BENCHMARK(BM_ListPopBothEnds);
+LIST_BENCHMARK(BM_ListMiddleInsertErase);
+LIST_BENCHMARK(BM_ListIterate);
+LIST_BENCHMARK(BM_ListCopy);
+LIST_BENCHMARK(BM_ListRangeConstruct);
+LIST_BENCHMARK(BM_ListAssign);
+LIST_BENCHMARK(BM_ListMove);
+LIST_BENCHMARK(BM_ListSort);
+LIST_BENCHMARK(BM_ListUnique);
+LIST_BENCHMARK(BM_ListReverse);
+LIST_BENCHMARK(BM_ListMerge);
+LIST_BENCHMARK(BM_ListSplice);
+LIST_BENCHMARK(BM_ListInsertMany);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <random>
+#include <string>
+
+#include "my_list.h"
+
+template <class T>
+static T MakeValue(std::mt19937 &gen);
+
+template <>
+int MakeValue<int>(std::mt19937 &gen) {
+  return static_cast<int>(gen());
+}
+
+template <>
+uint64_t MakeValue<uint64_t>(std::mt19937 &gen) {
+  return (uint64_t{gen()} << 32) | gen();
+}
+
+template <>
+double MakeValue<double>(std::mt19937 &gen) {
+  return std::uniform_real_distribution<double>(-1e9, 1e9)(gen);
+}
+
+template <>
+std::string MakeValue<std::string>(std::mt19937 &gen) {
+  return "key_" + std::to_string(gen()) + "_padding_out_of_sso";
+}
+
+template <class ListType>
+static void BM_Sort(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  std::mt19937 gen(42);
+  ListType list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      list.push_back(MakeValue<value_type>(gen));
+    }
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+// The merge sort that sort() replaces with a radix sort for arithmetic
+// types, forced by passing the comparator explicitly.
+template <class ListType>
+static void BM_SortComparison(benchmark::State &state) {
+  using value_type = typename ListType::value_type;
+  std::mt19937 gen(42);
+  ListType list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      list.push_back(MakeValue<value_type>(gen));
+    }
+    state.ResumeTiming();
+    list.sort(std::less<value_type>());
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Sort, mynamespace::List<int>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_Sort, std::list<int>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_Sort, mynamespace::List<std::string>)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_Sort, std::list<std::string>)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_SortComparison, mynamespace::List<int>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_Sort, mynamespace::List<uint64_t>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oN);
+BENCHMARK_TEMPLATE(BM_SortComparison, mynamespace::List<uint64_t>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_Sort, mynamespace::List<double>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oN);
+BENCHMARK_TEMPLATE(BM_SortComparison, mynamespace::List<double>)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Complexity(benchmark::oNLogN);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "bench_values.h"
+#include "my_map.h"
+#include "my_set.h"
+
+// The B-tree Map and Set against the red-black trees of std::map and
+// std::set: random point lookups, short range scans from a lower_bound,
+// random inserts into an empty container and erasing everything by key.
+// Lookups and erases step through the keys in an order unrelated to the
+// insertion order, so std::map's nodes are not visited in allocation order.
+
+static std::vector<int> MakeKeys(int64_t n) {
+  std::vector<int> keys;
+  keys.reserve(static_cast<size_t>(n));
+  for (int64_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast<int>(Scramble(static_cast<uint32_t>(i))));
+  }
+  return keys;
+}
+
+template <class Container>
+static void Fill(Container &c, const std::vector<int> &keys) {
+  if constexpr (std::is_same_v<typename Container::key_type,
+                               typename Container::value_type>) {
+    for (int key : keys) c.insert(key);
+  } else {
+    for (int key : keys) c.insert({key, key});
+  }
+}
+
+template <class Container>
+static void BM_TreeLookup(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0));
+  Container c;
+  Fill(c, keys);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(c.find(keys[i]));
+    i = (i + 7919) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Visits the 64 elements from a random lower_bound.
+template <class Container>
+static void BM_TreeRangeScan(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0));
+  Container c;
+  Fill(c, keys);
+  size_t i = 0;
+  for (auto _ : state) {
+    int64_t sum = 0;
+    auto it = c.lower_bound(keys[i]);
+    for (int n = 0; n < 64 && it != c.end(); ++n, ++it) {
+      if constexpr (std::is_same_v<typename Container::key_type,
+                                   typename Container::value_type>) {
+        sum += *it;
+      } else {
+        sum += it->second;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    i = (i + 7919) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+
+template <class Container>
+static void BM_TreeInsert(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0));
+  for (auto _ : state) {
+    Container c;
+    Fill(c, keys);
+    benchmark::DoNotOptimize(c.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container>
+static void BM_TreeErase(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container c;
+    Fill(c, keys);
+    state.ResumeTiming();
+    for (size_t i = 0, j = 0; i < keys.size(); ++i) {
+      c.erase(keys[j]);
+      j = (j + 7919) % keys.size();
+    }
+    benchmark::DoNotOptimize(c.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define TREE_BENCHMARK(fn, Container) \
+  BENCHMARK_TEMPLATE(fn, Container)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)
+
+using IntMap = mynamespace::Map<int, int>;
+using IntSet = mynamespace::Set<int>;
+using StdIntMap = std::map<int, int>;
+using StdIntSet = std::set<int>;
+
+TREE_BENCHMARK(BM_TreeLookup, IntMap);
+TREE_BENCHMARK(BM_TreeLookup, StdIntMap);
+TREE_BENCHMARK(BM_TreeLookup, IntSet);
+TREE_BENCHMARK(BM_TreeLookup, StdIntSet);
+TREE_BENCHMARK(BM_TreeRangeScan, IntMap);
+TREE_BENCHMARK(BM_TreeRangeScan, StdIntMap);
+TREE_BENCHMARK(BM_TreeInsert, IntMap);
+TREE_BENCHMARK(BM_TreeInsert, StdIntMap);
+TREE_BENCHMARK(BM_TreeErase, IntMap);
+TREE_BENCHMARK(BM_TreeErase, StdIntMap);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "my_mpmc_queue.h"
+#include "my_queue.h"
+
+constexpr size_t kCapacity = 1024;
+
+// The baseline: a bounded Queue guarded by a mutex.
+template <class T>
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  mynamespace::Queue<T> queue_;
+  size_t capacity_;
+};
+
+// Every thread is both a producer and a consumer of one shared queue.
+template <class QueueType>
+static void BM_Scaling(benchmark::State &state) {
+  static QueueType queue(kCapacity);
+  int64_t value = state.thread_index();
+  for (auto _ : state) {
+    while (!queue.try_push(value)) std::this_thread::yield();
+    while (!queue.try_pop(value)) std::this_thread::yield();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Scaling, mynamespace::MpmcQueue<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Scaling, LockedQueue<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+
+#include "my_list.h"
+#include "my_parallel.h"
+#include "my_thread_pool.h"
+
+// The parallel algorithms on a List of 1M doubles against their serial
+// counterparts. The second argument is the number of pool workers, the
+// calling thread making one more; with 0 workers the difference from the
+// serial loop is the cost of finding segment boundaries.
+
+static mynamespace::List<double> MakeList(int64_t n) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1e9, 1e9);
+  mynamespace::List<double> list;
+  for (int64_t i = 0; i < n; ++i) list.push_back(dist(gen));
+  return list;
+}
+
+static void BM_SerialReduce(benchmark::State &state) {
+  mynamespace::List<double> list = MakeList(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::accumulate(list.cbegin(), list.cend(), 0.0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParallelReduce(benchmark::State &state) {
+  mynamespace::List<double> list = MakeList(state.range(0));
+  mynamespace::ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mynamespace::parallel::reduce(
+        list, 0.0, std::plus<>(), mynamespace::parallel::kDefaultGrain, pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SerialTransform(benchmark::State &state) {
+  mynamespace::List<double> list = MakeList(state.range(0));
+  for (auto _ : state) {
+    for (double &x : list) x = std::sqrt(std::fabs(x));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParallelTransform(benchmark::State &state) {
+  mynamespace::List<double> list = MakeList(state.range(0));
+  mynamespace::ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    mynamespace::parallel::transform_inplace(
+        list, [](double x) { return std::sqrt(std::fabs(x)); },
+        mynamespace::parallel::kDefaultGrain, pool);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SerialSort(benchmark::State &state) {
+  mynamespace::List<double> source = MakeList(state.range(0));
+  mynamespace::List<double> list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list = mynamespace::List<double>(source);
+    state.ResumeTiming();
+    list.sort(std::less<double>());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParallelSort(benchmark::State &state) {
+  mynamespace::List<double> source = MakeList(state.range(0));
+  mynamespace::List<double> list;
+  mynamespace::ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    list = mynamespace::List<double>(source);
+    state.ResumeTiming();
+    mynamespace::parallel::sort(list, std::less<double>(),
+                                mynamespace::parallel::kDefaultGrain, pool);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SerialReduce)->Arg(1 << 20);
+BENCHMARK(BM_ParallelReduce)->Args({1 << 20, 0})->Args({1 << 20, 3});
+BENCHMARK(BM_SerialTransform)->Arg(1 << 20);
+BENCHMARK(BM_ParallelTransform)->Args({1 << 20, 0})->Args({1 << 20, 3});
+BENCHMARK(BM_SerialSort)->Arg(1 << 20);
+BENCHMARK(BM_ParallelSort)->Args({1 << 20, 0})->Args({1 << 20, 3});
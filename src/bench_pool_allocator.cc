@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include "my_list.h"
+#include "my_pool_allocator.h"
+
+// Push/pop churn at a steady depth: every operation allocates or frees a node.
+template <class ListType>
+static void BM_PushPopChurn(benchmark::State &state) {
+  ListType list;
+  for (int64_t i = 0; i < state.range(0); ++i) list.push_back(0);
+  for (auto _ : state) {
+    list.push_back(1);
+    list.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_PushPopChurn, mynamespace::List<int>)
+    ->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushPopChurn,
+                   mynamespace::List<int, mynamespace::PoolAllocator<int>>)
+    ->Range(8, 1 << 16);
+
+// Fill then drain: the pool keeps its blocks between rounds.
+template <class ListType>
+static void BM_FillDrain(benchmark::State &state) {
+  ListType list;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) list.push_back(i);
+    while (!list.empty()) list.pop_back();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_FillDrain, mynamespace::List<int>)->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_FillDrain,
+                   mynamespace::List<int, mynamespace::PoolAllocator<int>>)
+    ->Range(8, 1 << 16);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "bench_values.h"
+#include "my_priority_queue.h"
+
+// The 4-ary PriorityQueue against the binary heap of std::priority_queue
+// on std::vector: push random keys then pop them all, heapify a range, and
+// a steady-state scheduler loop that pops one job and pushes a later one.
+
+template <class T>
+static std::vector<T> MakeKeys(int64_t n) {
+  std::vector<T> keys;
+  keys.reserve(static_cast<size_t>(n));
+  for (int64_t i = 0; i < n; ++i) {
+    keys.push_back(MakeValue<T>(Scramble(static_cast<uint32_t>(i))));
+  }
+  return keys;
+}
+
+template <class Queue>
+static void BM_HeapPushPop(benchmark::State &state) {
+  using value_type = typename Queue::value_type;
+  std::vector<value_type> keys = MakeKeys<value_type>(state.range(0));
+  for (auto _ : state) {
+    Queue queue;
+    for (const value_type &key : keys) queue.push(key);
+    int64_t sum = 0;
+    while (!queue.empty()) {
+      sum += Weight(queue.top());
+      queue.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Queue>
+static void BM_HeapBuild(benchmark::State &state) {
+  using value_type = typename Queue::value_type;
+  std::vector<value_type> keys = MakeKeys<value_type>(state.range(0));
+  for (auto _ : state) {
+    Queue queue(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(queue.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Queue>
+static void BM_HeapScheduler(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys<int>(state.range(0));
+  Queue queue(keys.begin(), keys.end());
+  uint32_t i = 0;
+  for (auto _ : state) {
+    int next = queue.top() - static_cast<int>(Scramble(++i) % 1024);
+    queue.pop();
+    queue.push(next);
+  }
+  benchmark::DoNotOptimize(queue.top());
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Rescheduling a random timer in place through its handle, which
+// std::priority_queue cannot do at all.
+static void BM_HandleReschedule(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys<int>(state.range(0));
+  mynamespace::HandlePriorityQueue<int> queue;
+  std::vector<size_t> handles;
+  for (int key : keys) handles.push_back(queue.push(key));
+  uint32_t i = 0;
+  for (auto _ : state) {
+    ++i;
+    queue.update(handles[Scramble(i) % handles.size()],
+                 static_cast<int>(Scramble(i * 7)));
+  }
+  benchmark::DoNotOptimize(queue.top());
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define PRIORITY_QUEUE_BENCHMARK(fn, T)                       \
+  BENCHMARK_TEMPLATE(fn, mynamespace::PriorityQueue<T>)       \
+      ->Arg(1 << 10)                                          \
+      ->Arg(1 << 16)                                          \
+      ->Arg(1 << 20);                                         \
+  BENCHMARK_TEMPLATE(fn, std::priority_queue<T>)              \
+      ->Arg(1 << 10)                                          \
+      ->Arg(1 << 16)                                          \
+      ->Arg(1 << 20)
+
+PRIORITY_QUEUE_BENCHMARK(BM_HeapPushPop, int);
+PRIORITY_QUEUE_BENCHMARK(BM_HeapPushPop, Pod64);
+PRIORITY_QUEUE_BENCHMARK(BM_HeapPushPop, std::string);
+PRIORITY_QUEUE_BENCHMARK(BM_HeapBuild, int);
+PRIORITY_QUEUE_BENCHMARK(BM_HeapScheduler, int);
+BENCHMARK(BM_HandleReschedule)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+
+#include "my_queue.h"
+#include "my_ring_queue.h"
+
+constexpr size_t kDepth = 1024;
+
+template <class QueueType>
+static QueueType MakeQueue() {
+  return QueueType();
+}
+
+template <>
+mynamespace::RingQueue<int64_t> MakeQueue() {
+  return mynamespace::RingQueue<int64_t>(kDepth);
+}
+
+// Sustained FIFO traffic at a fixed depth that fits the ring.
+template <class QueueType>
+static void BM_BoundedThroughput(benchmark::State &state) {
+  QueueType queue = MakeQueue<QueueType>();
+  for (int64_t i = 0; i < state.range(0); ++i) queue.push(i);
+  int64_t value = 0;
+  for (auto _ : state) {
+    queue.push(value);
+    value += queue.front();
+    queue.pop();
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_BoundedThroughput,
+                   mynamespace::RingQueue<int64_t, kDepth>)
+    ->Range(8, kDepth - 1);
+BENCHMARK_TEMPLATE(BM_BoundedThroughput, mynamespace::RingQueue<int64_t>)
+    ->Range(8, kDepth - 1);
+BENCHMARK_TEMPLATE(BM_BoundedThroughput, mynamespace::Queue<int64_t>)
+    ->Range(8, kDepth - 1);
+BENCHMARK_TEMPLATE(BM_BoundedThroughput, std::queue<int64_t>)
+    ->Range(8, kDepth - 1);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_values.h"
+#include "my_list.h"
+#include "my_stack.h"
+
+// Short-lived stacks as a parser or DFS uses them: a fresh stack per walk,
+// filled to the given depth and drained again. SmallStack keeps 64 elements
+// inline, so the last depth shows the cost of spilling to the heap.
+
+template <class Adapter>
+static void BM_SmallStackWalk(benchmark::State &state) {
+  using value_type = typename Adapter::value_type;
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    Adapter stack;
+    for (int64_t i = 0; i < state.range(0); ++i) stack.push(value);
+    int64_t sum = 0;
+    while (!stack.empty()) {
+      sum += Weight(stack.top());
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The same walk on one long-lived stack, where Vector has long since
+// reached its peak capacity.
+template <class Adapter>
+static void BM_SmallStackReuse(benchmark::State &state) {
+  using value_type = typename Adapter::value_type;
+  value_type value = MakeValue<value_type>(1);
+  Adapter stack;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) stack.push(value);
+    int64_t sum = 0;
+    while (!stack.empty()) {
+      sum += Weight(stack.top());
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define SMALL_STACK_BENCHMARK(fn, T)                                       \
+  BENCHMARK_TEMPLATE(fn, mynamespace::SmallStack<T, 64>)                   \
+      ->Arg(8)                                                             \
+      ->Arg(32)                                                            \
+      ->Arg(64)                                                            \
+      ->Arg(256);                                                          \
+  BENCHMARK_TEMPLATE(fn, mynamespace::Stack<T>)                            \
+      ->Arg(8)                                                             \
+      ->Arg(32)                                                            \
+      ->Arg(64)                                                            \
+      ->Arg(256);                                                          \
+  BENCHMARK_TEMPLATE(fn, mynamespace::Stack<T, mynamespace::List<T>>)      \
+      ->Arg(8)                                                             \
+      ->Arg(32)                                                            \
+      ->Arg(64)                                                            \
+      ->Arg(256)
+
+SMALL_STACK_BENCHMARK(BM_SmallStackWalk, int);
+SMALL_STACK_BENCHMARK(BM_SmallStackWalk, Pod64);
+SMALL_STACK_BENCHMARK(BM_SmallStackReuse, int);
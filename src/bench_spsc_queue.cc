@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "my_queue.h"
+#include "my_spsc_queue.h"
+
+constexpr size_t kCapacity = 1024;
+
+// The baseline: a bounded Queue guarded by a mutex.
+template <class T>
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  mynamespace::Queue<T> queue_;
+  size_t capacity_;
+};
+
+template <class QueueType>
+static void Push(QueueType &queue, int64_t value) {
+  while (!queue.try_push(value)) std::this_thread::yield();
+}
+
+template <class QueueType>
+static int64_t Pop(QueueType &queue) {
+  int64_t value;
+  while (!queue.try_pop(value)) std::this_thread::yield();
+  return value;
+}
+
+// Items handed from the benchmark thread to a consumer thread.
+template <class QueueType>
+static void BM_Throughput(benchmark::State &state) {
+  QueueType queue(kCapacity);
+  std::thread consumer([&queue] {
+    while (Pop(queue) >= 0) {
+    }
+  });
+  for (auto _ : state) Push(queue, 1);
+  Push(queue, -1);
+  consumer.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Throughput, mynamespace::SpscQueue<int64_t>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, LockedQueue<int64_t>)->UseRealTime();
+
+// Round trip through a second thread that echoes every item back.
+template <class QueueType>
+static void BM_PingPong(benchmark::State &state) {
+  QueueType ping(kCapacity);
+  QueueType pong(kCapacity);
+  std::thread echo([&ping, &pong] {
+    int64_t value;
+    do {
+      value = Pop(ping);
+      Push(pong, value);
+    } while (value >= 0);
+  });
+  for (auto _ : state) {
+    Push(ping, 1);
+    benchmark::DoNotOptimize(Pop(pong));
+  }
+  Push(ping, -1);
+  Pop(pong);
+  echo.join();
+}
+
+BENCHMARK_TEMPLATE(BM_PingPong, mynamespace::SpscQueue<int64_t>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, LockedQueue<int64_t>)->UseRealTime();
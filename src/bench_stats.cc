@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bench_values.h"
+#include "my_list.h"
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_stats.h"
+#include "my_vector.h"
+
+// Cost of the CountingStats policy against the default NoStats on the
+// hottest paths: node churn, sort and adapter push/pop.
+
+template <class Stats>
+using StatsList = mynamespace::List<int, std::allocator<int>, Stats>;
+
+template <class Stats>
+static void BM_StatsListChurn(benchmark::State &state) {
+  StatsList<Stats> list;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      list.push_back(static_cast<int>(i));
+    }
+    for (int64_t i = 0; i < state.range(0); ++i) list.pop_front();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Stats>
+static void BM_StatsListSort(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    StatsList<Stats> list;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      list.push_back(MakeValue<int>(Scramble(static_cast<uint32_t>(i))));
+    }
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Stats>
+static void BM_StatsQueue(benchmark::State &state) {
+  mynamespace::Queue<int, StatsList<Stats>, Stats> queue;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      queue.push(static_cast<int>(i));
+    }
+    for (int64_t i = 0; i < state.range(0); ++i) queue.pop();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Stats>
+static void BM_StatsStack(benchmark::State &state) {
+  mynamespace::Stack<int, mynamespace::Vector<int>, Stats> stack;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      stack.push(static_cast<int>(i));
+    }
+    for (int64_t i = 0; i < state.range(0); ++i) stack.pop();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define STATS_BENCHMARK(name)                                        \
+  BENCHMARK_TEMPLATE(name, mynamespace::NoStats)->Arg(1 << 10);      \
+  BENCHMARK_TEMPLATE(name, mynamespace::CountingStats)->Arg(1 << 10)
+
+STATS_BENCHMARK(BM_StatsListChurn);
+STATS_BENCHMARK(BM_StatsListSort);
+STATS_BENCHMARK(BM_StatsQueue);
+STATS_BENCHMARK(BM_StatsStack);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+
+#include "my_list.h"
+#include "my_unrolled_list.h"
+
+template <class ListType>
+static void BM_Iterate(benchmark::State &state) {
+  ListType list;
+  for (int64_t i = 0; i < state.range(0); ++i) list.push_back(i);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Iterate, mynamespace::List<int64_t>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Iterate, mynamespace::UnrolledList<int64_t>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Iterate, std::list<int64_t>)->Range(1 << 10, 1 << 20);
+
+template <class ListType>
+static void BM_PushBackPopFront(benchmark::State &state) {
+  ListType list;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) list.push_back(i);
+    while (!list.empty()) list.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBackPopFront, mynamespace::List<int64_t>)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBackPopFront, mynamespace::UnrolledList<int64_t>)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBackPopFront, std::list<int64_t>)
+    ->Range(1 << 10, 1 << 16);
+
+template <class ListType>
+static void BM_PushFrontPopBack(benchmark::State &state) {
+  ListType list;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) list.push_front(i);
+    while (!list.empty()) list.pop_back();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushFrontPopBack, mynamespace::List<int64_t>)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushFrontPopBack, mynamespace::UnrolledList<int64_t>)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushFrontPopBack, std::list<int64_t>)
+    ->Range(1 << 10, 1 << 16);
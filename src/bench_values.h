@@ -0,0 +1,49 @@
+#ifndef SRC_BENCH_VALUES_H_
+#define SRC_BENCH_VALUES_H_
+
+#include <cstdint>
+#include <string>
+
+// Element types shared by the comparison benchmarks: a scalar, a 64-byte
+// trivially copyable record and a string too long for the small-string
+// buffer.
+
+struct Pod64 {
+  int64_t key;
+  char payload[56];
+
+  bool operator<(const Pod64 &other) const { return key < other.key; }
+  bool operator==(const Pod64 &other) const { return key == other.key; }
+};
+
+template <class T>
+T MakeValue(uint32_t seed);
+
+template <>
+inline int MakeValue<int>(uint32_t seed) {
+  return static_cast<int>(seed);
+}
+
+template <>
+inline Pod64 MakeValue<Pod64>(uint32_t seed) {
+  Pod64 value{};
+  value.key = seed;
+  return value;
+}
+
+template <>
+inline std::string MakeValue<std::string>(uint32_t seed) {
+  return "value_" + std::to_string(seed) + "_padding_out_of_sso";
+}
+
+// Pseudo-random but reproducible seeds.
+inline uint32_t Scramble(uint32_t i) { return i * 2654435761u; }
+
+// A number derived from a value, so reads cannot be optimized away.
+inline int64_t Weight(int value) { return value; }
+inline int64_t Weight(const Pod64 &value) { return value.key; }
+inline int64_t Weight(const std::string &value) {
+  return static_cast<int64_t>(value.size());
+}
+
+#endif  // SRC_BENCH_VALUES_H_
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <stack>
+
+#include "my_list.h"
+#include "my_stack.h"
+#include "my_vector.h"
+
+// Steady-state push/pop around a fixed depth.
+template <class StackType>
+static void BM_StackPushPop(benchmark::State &state) {
+  StackType stack;
+  for (int64_t i = 0; i < state.range(0); ++i) stack.push(i);
+  for (auto _ : state) {
+    for (int i = 0; i < 64; ++i) stack.push(i);
+    for (int i = 0; i < 64; ++i) stack.pop();
+  }
+  state.SetItemsProcessed(state.iterations() * 128);
+}
+
+BENCHMARK_TEMPLATE(BM_StackPushPop,
+                   mynamespace::Stack<int64_t, mynamespace::List<int64_t>>)
+    ->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_StackPushPop,
+                   mynamespace::Stack<int64_t, mynamespace::Vector<int64_t>>)
+    ->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::stack<int64_t>)->Range(8, 1 << 16);
+
+template <class VectorType>
+static void BM_PushBackGrow(benchmark::State &state) {
+  for (auto _ : state) {
+    VectorType v;
+    for (int64_t i = 0; i < state.range(0); ++i) v.push_back(i);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBackGrow, mynamespace::Vector<int64_t>)
+    ->Range(8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBackGrow, std::vector<int64_t>)->Range(8, 1 << 20);
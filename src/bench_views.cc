@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+
+#include "my_list.h"
+#include "my_views.h"
+
+// A filter, transform, take pipeline over a List of n ints, keeping half
+// of the elements and taking a quarter: with a List built by every stage,
+// through views materialized by to<List>(), and through views summed
+// without materializing anything.
+
+namespace views = mynamespace::views;
+
+static mynamespace::List<int> MakeList(int64_t n) {
+  mynamespace::List<int> list;
+  for (int64_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i));
+  return list;
+}
+
+static bool Even(int x) { return x % 2 == 0; }
+static int64_t Square(int x) { return int64_t{x} * x; }
+
+static void BM_EagerStages(benchmark::State &state) {
+  mynamespace::List<int> list = MakeList(state.range(0));
+  size_t n = static_cast<size_t>(state.range(0) / 4);
+  for (auto _ : state) {
+    mynamespace::List<int> filtered;
+    for (int x : list) {
+      if (Even(x)) filtered.push_back(x);
+    }
+    mynamespace::List<int64_t> squared;
+    for (int x : filtered) squared.push_back(Square(x));
+    mynamespace::List<int64_t> taken;
+    for (int64_t x : squared) {
+      if (taken.size() == n) break;
+      taken.push_back(x);
+    }
+    benchmark::DoNotOptimize(taken.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_LazyToList(benchmark::State &state) {
+  mynamespace::List<int> list = MakeList(state.range(0));
+  size_t n = static_cast<size_t>(state.range(0) / 4);
+  for (auto _ : state) {
+    auto taken = list | views::filter(Even) | views::transform(Square) |
+                 views::take(n) | mynamespace::to<mynamespace::List>();
+    benchmark::DoNotOptimize(taken.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_LazySum(benchmark::State &state) {
+  mynamespace::List<int> list = MakeList(state.range(0));
+  size_t n = static_cast<size_t>(state.range(0) / 4);
+  for (auto _ : state) {
+    auto view = list | views::filter(Even) | views::transform(Square) |
+                views::take(n);
+    benchmark::DoNotOptimize(
+        std::accumulate(view.begin(), view.end(), int64_t{0}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_EagerStages)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_LazyToList)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_LazySum)->Arg(1 << 10)->Arg(1 << 20);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "my_stack.h"
+#include "my_work_stealing_deque.h"
+
+// The baseline: a Stack guarded by a mutex; thieves take from the top too.
+template <class T>
+class LockedStack {
+ public:
+  void push(T value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool pop(T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+  bool steal(T &value) { return pop(value); }
+
+ private:
+  std::mutex mutex_;
+  mynamespace::Stack<T> stack_;
+};
+
+struct Range {
+  int32_t first;
+  int32_t last;
+};
+
+constexpr int32_t kElements = 1 << 22;
+constexpr int32_t kGrain = 1 << 10;
+
+// Fork-join tree sum: a range is split in halves until it is small enough,
+// the halves go to the worker's own deque and idle workers steal them.
+template <class DequeType>
+static int64_t TreeSum(const std::vector<int64_t> &data, int workers) {
+  std::vector<std::unique_ptr<DequeType>> deques;
+  for (int w = 0; w < workers; ++w) deques.emplace_back(new DequeType());
+  std::atomic<int64_t> pending(1);
+  std::atomic<int64_t> total(0);
+  deques[0]->push(Range{0, static_cast<int32_t>(data.size())});
+
+  auto work = [&](int self) {
+    int64_t sum = 0;
+    unsigned victim = self;
+    Range range;
+    while (pending.load(std::memory_order_acquire) > 0) {
+      bool found = deques[self]->pop(range);
+      for (int tries = 0; !found && tries < workers; ++tries) {
+        victim = (victim + 1) % workers;
+        found = victim != static_cast<unsigned>(self) &&
+                deques[victim]->steal(range);
+      }
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
+      while (range.last - range.first > kGrain) {
+        int32_t middle = range.first + (range.last - range.first) / 2;
+        pending.fetch_add(1, std::memory_order_relaxed);
+        deques[self]->push(Range{middle, range.last});
+        range.last = middle;
+      }
+      sum = std::accumulate(data.begin() + range.first,
+                            data.begin() + range.last, sum);
+      pending.fetch_sub(1, std::memory_order_release);
+    }
+    total.fetch_add(sum);
+  };
+
+  std::vector<std::thread> threads;
+  for (int w = 1; w < workers; ++w) threads.emplace_back(work, w);
+  work(0);
+  for (auto &thread : threads) thread.join();
+  return total.load();
+}
+
+template <class DequeType>
+static void BM_TreeSum(benchmark::State &state) {
+  std::vector<int64_t> data(kElements);
+  std::iota(data.begin(), data.end(), 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        TreeSum<DequeType>(data, static_cast<int>(state.range(0))));
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+BENCHMARK_TEMPLATE(BM_TreeSum, mynamespace::WorkStealingDeque<Range>)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TreeSum, LockedStack<Range>)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
@@ -0,0 +1,624 @@
+#ifndef SRC_MY_ARCHIVE_H_
+#define SRC_MY_ARCHIVE_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace mynamespace {
+
+// Binary archives of a sequence of elements, as written by save() of List,
+// Queue and Stack. A 64-byte header records a type tag, the element size,
+// the element count and a checksum of the payload that follows it:
+//
+//   Header | element 0 | element 1 | ... | element count - 1
+//
+// Trivially copyable elements are stored as their bytes, written and read
+// in blocks of kBlockBytes; the payload then starts 64 bytes into the file,
+// so a MappedView can iterate over it in place. Other element types need a
+// Traits specialization, which writes each element through a ByteWriter;
+// one for std::basic_string is provided. Archives are in the byte order of
+// the machine and are refused on one of the other order.
+//
+// Saving writes to path + ".tmp" and renames it over path when complete, so
+// an interrupted save leaves the previous archive intact. Loading reads the
+// whole archive before the container is changed; every failure throws
+// archive::Error.
+namespace archive {
+
+class Error : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+struct Header {
+  char magic[8];          // kMagic
+  uint32_t version;       // kVersion
+  uint32_t byte_order;    // kByteOrder as written by the saving machine
+  uint64_t type_tag;      // Traits<T>::tag() of the elements
+  uint64_t element_size;  // sizeof(T) when stored in bulk, otherwise 0
+  uint64_t count;         // Number of elements
+  uint64_t payload_size;  // Bytes after the header
+  uint64_t checksum;      // Checksum of the payload
+  uint64_t reserved;      // Zero
+};
+
+static_assert(sizeof(Header) == 64, "the payload must start at offset 64");
+
+constexpr char kMagic[8] = {'M', 'Y', 'A', 'R', 'C', 'H', 'V', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrder = 0x01020304;
+constexpr size_t kBlockBytes = size_t{1} << 16;  // Bytes per read or write
+
+namespace internal {
+
+// 64-bit checksum of a byte stream, eight bytes per step. Feeding the same
+// bytes in pieces of any length gives the same value.
+class Checksum {
+ public:
+  void update(const void *data, size_t n) noexcept {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    total_ += n;
+    if (pending_ > 0) {
+      size_t take = std::min(n, sizeof(tail_) - pending_);
+      std::memcpy(tail_ + pending_, p, take);
+      pending_ += take;
+      p += take;
+      n -= take;
+      if (pending_ < sizeof(tail_)) return;
+      mix(load(tail_));
+      pending_ = 0;
+    }
+    for (; n >= 8; p += 8, n -= 8) mix(load(p));
+    std::memcpy(tail_, p, n);
+    pending_ = n;
+  }  // Adds bytes to the stream
+
+  uint64_t value() const noexcept {
+    uint64_t h = h_;
+    if (pending_ > 0) {
+      unsigned char last[8] = {};
+      std::memcpy(last, tail_, pending_);
+      h = step(h, load(last));
+    }
+    h ^= total_;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return h;
+  }  // Returns the checksum of the bytes added so far
+
+ private:
+  static uint64_t load(const unsigned char *p) noexcept {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    return word;
+  }
+
+  static uint64_t step(uint64_t h, uint64_t word) noexcept {
+    h ^= word * 0x9E3779B97F4A7C15ULL;
+    return ((h << 29) | (h >> 35)) * 0xBF58476D1CE4E5B9ULL;
+  }
+
+  void mix(uint64_t word) noexcept { h_ = step(h_, word); }
+
+  uint64_t h_ = 0;
+  uint64_t total_ = 0;
+  unsigned char tail_[8] = {};
+  size_t pending_ = 0;
+};
+
+inline Error os_error(const std::string &what, const std::string &path) {
+  return Error(what + " " + path + ": " + std::strerror(errno));
+}
+
+// Owned file descriptor with the loops that partial reads and writes need.
+class File {
+ public:
+  File(const std::string &path, int flags) : path_(path) {
+    do {
+      fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    } while (fd_ < 0 && errno == EINTR);
+    if (fd_ < 0) throw os_error("cannot open", path);
+  }
+  File(const File &) = delete;
+  File &operator=(const File &) = delete;
+  ~File() {
+    if (fd_ >= 0) ::close(fd_);
+  }
+
+  int fd() const noexcept { return fd_; }
+  const std::string &path() const noexcept { return path_; }
+
+  uint64_t size() const {
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) throw os_error("cannot stat", path_);
+    return static_cast<uint64_t>(st.st_size);
+  }  // Returns the file size in bytes
+
+  void write(const void *data, size_t n, off_t offset = -1) {
+    const char *p = static_cast<const char *>(data);
+    while (n > 0) {
+      ssize_t done = offset < 0 ? ::write(fd_, p, n)
+                                : ::pwrite(fd_, p, n, offset);
+      if (done < 0) {
+        if (errno == EINTR) continue;
+        throw os_error("cannot write", path_);
+      }
+      p += done;
+      n -= static_cast<size_t>(done);
+      if (offset >= 0) offset += done;
+    }
+  }  // Writes n bytes at the file position, or at offset if given
+
+  void read(void *data, size_t n) {
+    char *p = static_cast<char *>(data);
+    while (n > 0) {
+      ssize_t done = ::read(fd_, p, n);
+      if (done < 0) {
+        if (errno == EINTR) continue;
+        throw os_error("cannot read", path_);
+      }
+      if (done == 0) throw Error("unexpected end of archive " + path_);
+      p += done;
+      n -= static_cast<size_t>(done);
+    }
+  }  // Reads exactly n bytes
+
+  void close() {
+    int fd = fd_;
+    fd_ = -1;
+    if (::close(fd) != 0) throw os_error("cannot close", path_);
+  }  // Closes the file, reporting errors of delayed writes
+
+ private:
+  std::string path_;
+  int fd_;
+};
+
+template <class T>
+struct BlockDeleter {
+  void operator()(T *p) const noexcept { std::allocator<T>().deallocate(p, n); }
+  size_t n;
+};
+
+// Uninitialized storage for a block of elements stored in bulk.
+template <class T>
+std::unique_ptr<T, BlockDeleter<T>> allocate_block(size_t n) {
+  return std::unique_ptr<T, BlockDeleter<T>>(std::allocator<T>().allocate(n),
+                                             BlockDeleter<T>{n});
+}
+
+template <class T>
+constexpr size_t kBlockElements =
+    sizeof(T) < kBlockBytes ? kBlockBytes / sizeof(T) : 1;
+
+inline uint64_t name_tag(const char *name) noexcept {
+  uint64_t h = 0xCBF29CE484222325ULL;
+  for (; *name; ++name) {
+    h ^= static_cast<unsigned char>(*name);
+    h *= 0x100000001B3ULL;
+  }
+  return h;
+}  // FNV-1a of a type name
+
+}  // namespace internal
+
+// Buffered payload output of a Traits specialization.
+class ByteWriter {
+ public:
+  explicit ByteWriter(internal::File &file)
+      : file_(file), buffer_(new unsigned char[kBlockBytes]) {}
+
+  void put(const void *data, size_t n) {
+    checksum_.update(data, n);
+    written_ += n;
+    if (used_ + n > kBlockBytes) flush();
+    if (n >= kBlockBytes) {
+      file_.write(data, n);
+    } else {
+      std::memcpy(buffer_.get() + used_, data, n);
+      used_ += n;
+    }
+  }  // Appends n bytes to the payload
+
+  template <class U, class = std::enable_if_t<std::is_arithmetic_v<U>>>
+  void put(U value) {
+    put(&value, sizeof(value));
+  }  // Appends the bytes of a number
+
+  void flush() {
+    file_.write(buffer_.get(), used_);
+    used_ = 0;
+  }  // Writes out the buffered bytes
+
+  uint64_t written() const noexcept { return written_; }
+  uint64_t checksum() const noexcept { return checksum_.value(); }
+
+ private:
+  internal::File &file_;
+  std::unique_ptr<unsigned char[]> buffer_;
+  size_t used_ = 0;
+  uint64_t written_ = 0;
+  internal::Checksum checksum_;
+};
+
+// Buffered payload input of a Traits specialization. Reading past the
+// payload throws, so a corrupt length cannot run off the end of the file.
+class ByteReader {
+ public:
+  ByteReader(internal::File &file, uint64_t payload_size)
+      : file_(file),
+        buffer_(new unsigned char[kBlockBytes]),
+        remaining_(payload_size) {}
+
+  void get(void *data, size_t n) {
+    if (n > remaining()) {
+      throw Error("archive " + file_.path() + " is shorter than its header");
+    }
+    unsigned char *p = static_cast<unsigned char *>(data);
+    size_t from_buffer = std::min(n, end_ - begin_);
+    std::memcpy(p, buffer_.get() + begin_, from_buffer);
+    begin_ += from_buffer;
+    size_t rest = n - from_buffer;
+    if (rest >= kBlockBytes) {
+      file_.read(p + from_buffer, rest);
+    } else if (rest > 0) {
+      end_ = static_cast<size_t>(
+          std::min<uint64_t>(kBlockBytes, remaining_ - from_buffer));
+      file_.read(buffer_.get(), end_);
+      std::memcpy(p + from_buffer, buffer_.get(), rest);
+      begin_ = rest;
+    }
+    remaining_ -= n;
+    checksum_.update(data, n);
+  }  // Reads the next n bytes of the payload
+
+  template <class U, class = std::enable_if_t<std::is_arithmetic_v<U>>>
+  U get() {
+    U value;
+    get(&value, sizeof(value));
+    return value;
+  }  // Reads a number
+
+  uint64_t remaining() const noexcept {
+    return remaining_;
+  }  // Returns the payload bytes not read yet
+  uint64_t checksum() const noexcept { return checksum_.value(); }
+
+ private:
+  internal::File &file_;
+  std::unique_ptr<unsigned char[]> buffer_;
+  size_t begin_ = 0;  // Buffered bytes not handed out yet are
+  size_t end_ = 0;    // [begin_, end_) of buffer_
+  uint64_t remaining_;
+  internal::Checksum checksum_;
+};
+
+// How elements of type T are stored. Types that are neither trivially
+// copyable nor strings need a specialization with kBulk = false, a tag()
+// unique among the types archived, and
+//   static void write(ByteWriter &out, const T &value);
+//   static T read(ByteReader &in);
+template <class T, class = void>
+struct Traits {};
+
+template <class T>
+struct Traits<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+  static constexpr bool kBulk = true;  // Stored as its bytes
+
+  static uint64_t tag() noexcept {
+    if constexpr (std::is_arithmetic_v<T>) {
+      char kind = std::is_same_v<T, bool>          ? 'b'
+                  : std::is_floating_point_v<T>    ? 'f'
+                  : std::is_signed_v<T>            ? 'i'
+                                                   : 'u';
+      return (uint64_t{static_cast<unsigned char>(kind)} << 8) | sizeof(T);
+    } else {
+      return internal::name_tag(typeid(T).name());
+    }
+  }  // Numbers are tagged by kind and size, other types by their name
+};
+
+template <class CharT, class CharTraits, class Allocator>
+struct Traits<std::basic_string<CharT, CharTraits, Allocator>> {
+  using string_type = std::basic_string<CharT, CharTraits, Allocator>;
+
+  static constexpr bool kBulk = false;
+
+  static uint64_t tag() noexcept {
+    return (uint64_t{'s'} << 8) | sizeof(CharT);
+  }
+
+  static void write(ByteWriter &out, const string_type &s) {
+    out.put(static_cast<uint64_t>(s.size()));
+    out.put(s.data(), s.size() * sizeof(CharT));
+  }  // Length, then the characters
+
+  static string_type read(ByteReader &in) {
+    uint64_t n = in.get<uint64_t>();
+    if (n > in.remaining() / sizeof(CharT)) {
+      throw Error("archive string runs past the payload");
+    }
+    string_type s(static_cast<size_t>(n), CharT());
+    in.get(&s[0], s.size() * sizeof(CharT));
+    return s;
+  }
+};
+
+namespace internal {
+
+template <class T>
+void check_header(const Header &h, uint64_t file_size,
+                  const std::string &path) {
+  auto fail = [&path](const char *why) {
+    return Error("archive " + path + ": " + why);
+  };
+  if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) {
+    throw fail("not an archive");
+  }
+  if (h.version != kVersion) throw fail("unsupported version");
+  if (h.byte_order != kByteOrder) throw fail("saved with other byte order");
+  if (h.type_tag != Traits<T>::tag()) throw fail("holds another type");
+  if (h.element_size != (Traits<T>::kBulk ? sizeof(T) : 0)) {
+    throw fail("element size differs");
+  }
+  if (h.payload_size != file_size - sizeof(Header)) {
+    throw fail("size does not match its header");
+  }
+  if (Traits<T>::kBulk && (h.payload_size % sizeof(T) != 0 ||
+                           h.payload_size / sizeof(T) != h.count)) {
+    throw fail("count does not match its size");
+  }
+}
+
+}  // namespace internal
+
+// Writes n elements starting at first to an archive at path. A pointer
+// into contiguous storage of bulk elements is written without copying.
+template <class T, class InputIt>
+void write(const std::string &path, InputIt first, size_t n) {
+  std::string tmp = path + ".tmp";
+  try {
+    internal::File file(tmp, O_WRONLY | O_CREAT | O_TRUNC);
+    Header header{};
+    file.write(&header, sizeof(header));
+    ByteWriter out(file);
+    if constexpr (Traits<T>::kBulk && std::is_same_v<InputIt, const T *>) {
+      out.put(first, n * sizeof(T));
+    } else if constexpr (Traits<T>::kBulk) {
+      constexpr size_t kBlock = internal::kBlockElements<T>;
+      auto block = internal::allocate_block<T>(kBlock);
+      for (size_t done = 0; done < n;) {
+        size_t k = std::min(kBlock, n - done);
+        for (size_t i = 0; i < k; ++i, ++first) {
+          std::memcpy(static_cast<void *>(block.get() + i),
+                      std::addressof(*first), sizeof(T));
+        }
+        out.put(block.get(), k * sizeof(T));
+        done += k;
+      }
+    } else {
+      for (size_t i = 0; i < n; ++i, ++first) Traits<T>::write(out, *first);
+    }
+    out.flush();
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrder;
+    header.type_tag = Traits<T>::tag();
+    header.element_size = Traits<T>::kBulk ? sizeof(T) : 0;
+    header.count = n;
+    header.payload_size = out.written();
+    header.checksum = out.checksum();
+    file.write(&header, sizeof(header), 0);
+    file.close();
+  } catch (...) {
+    ::unlink(tmp.c_str());
+    throw;
+  }
+  if (::rename(tmp.c_str(), path.c_str()) != 0) {
+    Error error = internal::os_error("cannot rename " + tmp + " to", path);
+    ::unlink(tmp.c_str());
+    throw error;
+  }
+}
+
+// Reads an archive of elements of type T, checking the header on
+// construction and the checksum after the last element.
+template <class T>
+class Reader {
+ public:
+  explicit Reader(const std::string &path) : file_(path, O_RDONLY) {
+    uint64_t file_size = file_.size();
+    if (file_size < sizeof(Header)) {
+      throw Error("archive " + path + " is shorter than its header");
+    }
+    file_.read(&header_, sizeof(header_));
+    internal::check_header<T>(header_, file_size, path);
+  }
+
+  size_t size() const noexcept {
+    return static_cast<size_t>(header_.count);
+  }  // Returns the number of elements
+
+  template <class Function>
+  void for_each(Function f) {
+    ByteReader in(file_, header_.payload_size);
+    size_t n = size();
+    if constexpr (Traits<T>::kBulk) {
+      constexpr size_t kBlock = internal::kBlockElements<T>;
+      auto block = internal::allocate_block<T>(kBlock);
+      for (size_t done = 0; done < n;) {
+        size_t k = std::min(kBlock, n - done);
+        in.get(block.get(), k * sizeof(T));
+        for (size_t i = 0; i < k; ++i) f(std::move(block.get()[i]));
+        done += k;
+      }
+    } else {
+      for (size_t i = 0; i < n; ++i) f(Traits<T>::read(in));
+    }
+    if (in.remaining() != 0 || in.checksum() != header_.checksum) {
+      throw Error("archive " + file_.path() + " is corrupt");
+    }
+  }  // Calls f with every element, moved out, in order; throws once all
+     // are read if the payload does not match its checksum
+
+ private:
+  internal::File file_;
+  Header header_;
+};
+
+// Read-only view of an archive of bulk elements, mapped into memory: the
+// elements are iterated in place, without copying or decoding them.
+template <class T>
+class MappedView {
+  static_assert(Traits<T>::kBulk, "only bulk elements can be mapped");
+  static_assert(alignof(T) <= sizeof(Header),
+                "the payload is only aligned to the header size");
+
+ public:
+  // Member types
+  using value_type = T;                 // The type of an element
+  using const_reference = const T &;    // The type of the reference to one
+  using const_iterator = const T *;     // The type for iterating
+  using size_type = size_t;             // The type of the view size
+
+  // Member functions
+  explicit MappedView(const std::string &path,
+                      bool verify = true) {
+    internal::File file(path, O_RDONLY);
+    bytes_ = static_cast<size_t>(file.size());
+    if (bytes_ < sizeof(Header)) {
+      throw Error("archive " + path + " is shorter than its header");
+    }
+    void *p = ::mmap(nullptr, bytes_, PROT_READ, MAP_PRIVATE, file.fd(), 0);
+    if (p == MAP_FAILED) throw internal::os_error("cannot map", path);
+    map_ = p;
+    try {
+      const Header &header = *static_cast<const Header *>(map_);
+      internal::check_header<T>(header, bytes_, path);
+      size_ = static_cast<size_type>(header.count);
+      if (verify) {
+        internal::Checksum checksum;
+        checksum.update(data(), header.payload_size);
+        if (checksum.value() != header.checksum) {
+          throw Error("archive " + path + " is corrupt");
+        }
+      }
+    } catch (...) {
+      ::munmap(map_, bytes_);
+      throw;
+    }
+  }  // Maps the archive at path; verify reads it once to check the checksum
+  MappedView(MappedView &&other) noexcept
+      : map_(std::exchange(other.map_, nullptr)),
+        bytes_(std::exchange(other.bytes_, 0)),
+        size_(std::exchange(other.size_, 0)) {}  // Move constructor
+  MappedView(const MappedView &) = delete;
+  MappedView &operator=(MappedView other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(size_, other.size_);
+    return *this;
+  }  // Assignment operator overload for moving object
+  ~MappedView() {
+    if (map_) ::munmap(map_, bytes_);
+  }  // Destructor
+
+  // Element access
+
+  const_reference operator[](size_type i) const noexcept { return data()[i]; }
+  const_reference front() const noexcept { return data()[0]; }
+  const_reference back() const noexcept { return data()[size_ - 1]; }
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(static_cast<const char *>(map_) +
+                                       sizeof(Header));
+  }  // The elements, in the order they were saved
+
+  // Iterators
+
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + size_; }
+
+  // Capacity
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+ private:
+  void *map_ = nullptr;
+  size_t bytes_ = 0;
+  size_type size_ = 0;
+};
+
+namespace internal {
+
+template <class C>
+auto save_contents(const C &c, const std::string &path, int)
+    -> decltype(c.data(), void()) {
+  using value_type = typename C::value_type;
+  write<value_type>(path, static_cast<const value_type *>(c.data()),
+                    c.size());
+}  // Contiguous containers such as Vector
+
+template <class C>
+void save_contents(const C &c, const std::string &path, long) {
+  write<typename C::value_type>(path, c.cbegin(), c.size());
+}  // Any other container, walked from cbegin
+
+template <class C>
+auto load_contents(C &c, const std::string &path, int)
+    -> decltype(c.load(path), void()) {
+  c.load(path);
+}  // Containers with their own load, such as List
+
+template <class C>
+auto reserve(C &c, size_t n, int) -> decltype(c.reserve(n), void()) {
+  c.reserve(n);
+}
+
+template <class C>
+void reserve(C &, size_t, long) {}
+
+template <class C>
+void load_contents(C &c, const std::string &path, long) {
+  Reader<typename C::value_type> reader(path);
+  C loaded;
+  if (Traits<typename C::value_type>::kBulk) {
+    reserve(loaded, reader.size(), 0);
+  }
+  reader.for_each([&loaded](auto &&value) {
+    loaded.push_back(std::forward<decltype(value)>(value));
+  });
+  c = std::move(loaded);
+}  // Any other container, filled with push_back and moved into place
+
+}  // namespace internal
+
+template <class Container>
+void save(const Container &c, const std::string &path) {
+  internal::save_contents(c, path, 0);
+}  // Writes the elements of a container to an archive at path
+
+template <class Container>
+void load(Container &c, const std::string &path) {
+  internal::load_contents(c, path, 0);
+}  // Replaces the elements of a container with those of an archive
+
+}  // namespace archive
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_ARCHIVE_H_
@@ -0,0 +1,205 @@
+#ifndef SRC_MY_BLOCKING_QUEUE_H_
+#define SRC_MY_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "my_queue.h"
+
+namespace mynamespace {
+
+// Thread-safe wrapper around Queue<T, Container>, guarded by one mutex.
+// Producers block in push while the queue holds capacity() elements;
+// consumers block in pop_wait, or give up after a timeout in try_pop_for.
+// pop_all and pop_up_to hand over a whole batch under a single lock, which
+// is what keeps a busy consumer off the mutex. Condition variables are only
+// signalled when a thread is actually waiting on them. After close() pushes
+// fail and consumers drain what is left, then stop waiting.
+template <class T, class Container = mynamespace::Deque<T>>
+class BlockingQueue {
+ public:
+  // Member types
+  using container_type = Container;  // The type of the underlying container
+  using value_type = typename Container::value_type;  // The type of an element
+  using reference =
+      typename Container::reference;  // The type of the reference to an element
+  using const_reference =
+      typename Container::const_reference;  // The type of the constant
+                                            // reference to an element
+  using size_type =
+      typename Container::size_type;  // The type of the container size
+
+  // Member functions
+  explicit BlockingQueue(
+      size_type capacity =
+          std::numeric_limits<size_type>::max())  // Parameterized constructor
+      : capacity_(capacity) {}
+  BlockingQueue(const BlockingQueue &) = delete;
+  BlockingQueue &operator=(const BlockingQueue &) = delete;
+  ~BlockingQueue() {}  // Destructor
+
+  // Capacity
+
+  bool empty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return q_.empty();
+  }  // Checks whether the queue is empty
+
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return q_.size();
+  }  // Returns the number of elements
+
+  size_type capacity() const noexcept {
+    return capacity_;
+  }  // Returns the number of elements at which push blocks
+
+  // Producer
+
+  bool push(const_reference value) {
+    return emplace(value);
+  }  // Inserts element, waits for room; false once closed
+
+  bool push(value_type &&value) {
+    return emplace(std::move(value));
+  }  // Moves element, waits for room; false once closed
+
+  template <class... Args>
+  bool emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!closed_ && q_.size() >= capacity_) {
+      ++waiting_producers_;
+      not_full_.wait(lock,
+                     [this] { return closed_ || q_.size() < capacity_; });
+      --waiting_producers_;
+    }
+    if (closed_) return false;
+    q_.emplace(std::forward<Args>(args)...);
+    wake_consumer(lock);
+    return true;
+  }  // Constructs element in-place, waits for room; false once closed
+
+  bool try_push(const_reference value) {
+    return try_emplace(value);
+  }  // Inserts element unless full or closed
+
+  bool try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+  }  // Moves element unless full or closed
+
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || q_.size() >= capacity_) return false;
+    q_.emplace(std::forward<Args>(args)...);
+    wake_consumer(lock);
+    return true;
+  }  // Constructs element in-place unless full or closed
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }  // Rejects further pushes and wakes every waiting thread
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }  // Checks whether the queue was closed
+
+  // Consumer
+
+  bool pop_wait(value_type &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_empty(lock);
+    return take(lock, value);
+  }  // Waits for the first element; false once closed and drained
+
+  bool try_pop(value_type &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return take(lock, value);
+  }  // Takes the first element unless empty
+
+  template <class Rep, class Period>
+  bool try_pop_for(value_type &value,
+                   const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!closed_ && q_.empty()) {
+      ++waiting_consumers_;
+      not_empty_.wait_for(lock, timeout,
+                          [this] { return closed_ || !q_.empty(); });
+      --waiting_consumers_;
+    }
+    return take(lock, value);
+  }  // Waits up to timeout for the first element
+
+  template <class OutputIt>
+  size_type pop_all(OutputIt out) {
+    return pop_up_to(out, std::numeric_limits<size_type>::max());
+  }  // Waits for elements, then takes all of them; 0 once closed and drained
+
+  template <class OutputIt>
+  size_type pop_up_to(OutputIt out, size_type n) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_empty(lock);
+    size_type count = 0;
+    for (; count < n && !q_.empty(); ++count, ++out) {
+      *out = std::move(*q_.container().begin());
+      q_.pop();
+    }
+    if (count > 0) wake_producers(lock, count);
+    return count;
+  }  // Waits for elements, then takes up to n; 0 once closed and drained
+
+ private:
+  void wait_not_empty(std::unique_lock<std::mutex> &lock) {
+    if (closed_ || !q_.empty()) return;
+    ++waiting_consumers_;
+    not_empty_.wait(lock, [this] { return closed_ || !q_.empty(); });
+    --waiting_consumers_;
+  }  // Waits under the held lock until an element arrives or the queue closes
+
+  bool take(std::unique_lock<std::mutex> &lock, value_type &value) {
+    if (q_.empty()) return false;
+    value = std::move(*q_.container().begin());
+    q_.pop();
+    wake_producers(lock, 1);
+    return true;
+  }  // Moves out the first element under the held lock, then releases it
+
+  void wake_consumer(std::unique_lock<std::mutex> &lock) {
+    bool waiting = waiting_consumers_ > 0;
+    lock.unlock();
+    if (waiting) not_empty_.notify_one();
+  }  // Releases the lock and wakes a consumer if one is asleep
+
+  void wake_producers(std::unique_lock<std::mutex> &lock, size_type freed) {
+    size_type waiting = waiting_producers_;
+    lock.unlock();
+    if (waiting > 1 && freed > 1) {
+      not_full_.notify_all();
+    } else if (waiting > 0) {
+      not_full_.notify_one();
+    }
+  }  // Releases the lock and wakes producers if any are asleep
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  Queue<T, Container> q_;
+  size_type capacity_;
+  size_type waiting_consumers_ = 0;
+  size_type waiting_producers_ = 0;
+  bool closed_ = false;
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_BLOCKING_QUEUE_H_
@@ -0,0 +1,1084 @@
+#ifndef SRC_MY_BTREE_H_
+#define SRC_MY_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mynamespace {
+
+// Ordered storage shared by Set, Multiset and Map. Elements sit in B-tree
+// nodes of about kNodeBytes, a few cache lines each, so a lookup touches
+// one node per level of a tree that is several times shallower than a
+// red-black tree, and an in-order scan reads whole runs of contiguous
+// elements. Every node but the root holds between kMinSlots and kSlots
+// elements; internal nodes also hold count + 1 children.
+//
+// Elements are relocated between nodes as the tree splits and merges, so
+// unlike std::map every insert and erase invalidates all iterators into
+// the tree (erase returns a valid one to the next element). Value is
+// Key for sets and std::pair<const Key, T> for maps; Multi selects whether
+// equal keys may repeat.
+template <class Key, class Value, class Compare, class Allocator, bool Multi>
+class BTree {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  // Member types
+  using key_type = Key;      // The type of a key
+  using value_type = Value;  // The type of an element
+  using reference = Value &;  // The type of the reference to an element
+  using const_reference =
+      const Value &;  // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using difference_type = std::ptrdiff_t;  // The type of iterator distances
+  using key_compare = Compare;             // The type of the key ordering
+  using allocator_type = Allocator;        // The type of the element allocator
+
+ private:
+  static constexpr size_t kNodeBytes = 256;  // Target size of a leaf node
+  static constexpr size_t kHeaderBytes = 2 * sizeof(void *);
+
+ public:
+  static constexpr size_type kSlots =
+      (kNodeBytes - kHeaderBytes) / sizeof(Value) < 3
+          ? 3
+          : (kNodeBytes - kHeaderBytes) / sizeof(Value);  // Node capacity
+  static constexpr size_type kMinSlots =
+      (kSlots - 1) / 2;  // Fill of every node but the root
+
+ private:
+  struct InternalNode;
+
+  struct Node {
+    InternalNode *parent;     // Null for the root
+    unsigned short position;  // Index among the parent's children
+    unsigned short count;     // Number of elements
+    bool leaf;
+    alignas(Value) unsigned char storage[kSlots * sizeof(Value)];
+
+    Value *slot(size_type i) { return reinterpret_cast<Value *>(storage) + i; }
+  };
+
+  struct InternalNode : Node {
+    Node *children[kSlots + 1];
+  };
+
+  static_assert(kSlots <= std::numeric_limits<unsigned short>::max(),
+                "Node count must fit its field");
+
+  using leaf_allocator =
+      typename alloc_traits::template rebind_alloc<Node>;
+  using leaf_traits = std::allocator_traits<leaf_allocator>;
+  using internal_allocator =
+      typename alloc_traits::template rebind_alloc<InternalNode>;
+  using internal_traits = std::allocator_traits<internal_allocator>;
+
+  template <class Element>
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::remove_const_t<Element>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Element *;
+    using reference = Element &;
+
+    Iterator() : node_(nullptr), position_(0) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Element> &&
+                               !std::is_same_v<Other, Element>>>
+    Iterator(const Iterator<Other> &it)
+        : node_(it.node_),
+          position_(it.position_) {}  // Converts iterator into const_iterator
+
+    reference operator*() const { return *node_->slot(position_); }
+    pointer operator->() const { return node_->slot(position_); }
+
+    Iterator &operator++() {
+      increment();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator old = *this;
+      increment();
+      return old;
+    }
+
+    Iterator &operator--() {
+      decrement();
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      Iterator old = *this;
+      decrement();
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_ && position_ == other.position_;
+    }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    friend class BTree;
+    template <class>
+    friend class Iterator;
+
+    Iterator(Node *node, size_type position)
+        : node_(node), position_(position) {}
+
+    // The next element is the leftmost of the following subtree, or, past
+    // the end of a leaf, the separator of the first ancestor entered from
+    // the left. Past the last element the iterator stops at the root's end,
+    // which is what end() returns.
+    void increment() {
+      if (!node_->leaf) {
+        node_ = static_cast<InternalNode *>(node_)->children[position_ + 1];
+        while (!node_->leaf) {
+          node_ = static_cast<InternalNode *>(node_)->children[0];
+        }
+        position_ = 0;
+        return;
+      }
+      ++position_;
+      while (position_ == node_->count && node_->parent) {
+        position_ = node_->position;
+        node_ = node_->parent;
+      }
+    }
+
+    void decrement() {
+      if (!node_->leaf) {
+        node_ = static_cast<InternalNode *>(node_)->children[position_];
+        while (!node_->leaf) {
+          node_ = static_cast<InternalNode *>(node_)->children[node_->count];
+        }
+        position_ = node_->count - 1;
+      } else if (position_ > 0) {
+        --position_;
+      } else {
+        while (node_->parent && node_->position == 0) node_ = node_->parent;
+        position_ = node_->position - 1;
+        node_ = node_->parent;
+      }
+    }
+
+    Node *node_;
+    size_type position_;
+  };
+
+ public:
+  using iterator = Iterator<Value>;  // Bidirectional, in key order
+  using const_iterator = Iterator<const Value>;
+
+  // Member functions
+  BTree();                                   // Default constructor
+  explicit BTree(const Compare &compare,
+                 const Allocator &alloc = Allocator());  // Comparator and
+                                                         // allocator
+                                                         // constructor
+  BTree(const BTree &other);      // Copy constructor, same node layout
+  BTree(BTree &&other) noexcept;  // Move constructor
+  ~BTree();                       // Destructor
+  BTree &operator=(BTree &&other) noexcept;  // Assignment operator overload
+                                             // for moving object
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+  key_compare key_comp() const;          // Returns the key ordering
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the smallest element
+  iterator end() noexcept;    // Returns an iterator past the greatest one
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+
+  // Modifiers
+  void clear() noexcept;           // Clears the contents
+  iterator erase(iterator pos);    // Erases element at pos and returns the
+                                   // iterator to the next one
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);  // Erases all elements with key
+  void swap(BTree &other) noexcept;      // Swaps the contents
+
+  // Lookup
+  iterator find(const key_type &key);  // Finds an element with key
+  const_iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;  // Checks whether there is an
+                                             // element with key
+  size_type count(
+      const key_type &key) const;  // Returns the number of elements with key
+  iterator lower_bound(
+      const key_type &key);  // Returns the first element not less than key
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(
+      const key_type &key);  // Returns the first element greater than key
+  const_iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(
+      const key_type &key);  // Returns the range of elements with key
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const;
+
+ protected:
+  static const key_type &key_of(const value_type &value) {
+    if constexpr (std::is_same_v<key_type, value_type>) {
+      return value;
+    } else {
+      return value.first;
+    }
+  }  // The key part of an element
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace_key(
+      const key_type &key,
+      Args &&...args);  // Inserts value_type(args...) under key, unless the
+                        // container is unique and already has key
+  template <class... Args>
+  std::pair<iterator, bool> emplace_value(
+      Args &&...args);  // Constructs the element first to find its key
+  void merge_from(BTree &other);  // Moves over the elements that fit,
+                                  // leaving the rest in other
+
+ private:
+  size_type lower_index(Node *node, const key_type &key) const;
+  size_type upper_index(Node *node, const key_type &key) const;
+  Node *leftmost() const;  // The leaf holding the smallest element
+
+  iterator insert_at(Node *leaf, size_type i,
+                     value_type &&value);  // Inserts into a leaf, splitting
+                                           // it first if it is full
+  void split(Node *node);  // Splits a full node around its middle element
+  iterator remove(Node *node,
+                  size_type i);  // Erases the element at slot i of node
+  void rebalance(Node *node,
+                 iterator &track);  // Restores the fill of node and its
+                                    // ancestors, keeping track on its element
+  void rotate_right(Node *left, Node *node, InternalNode *parent,
+                    size_type s);  // Moves one element from left into node
+  void rotate_left(Node *node, Node *right, InternalNode *parent,
+                   size_type s);  // Moves one element from right into node
+  void merge_nodes(Node *left, Node *right, InternalNode *parent,
+                   size_type s);  // Joins right and separator s into left
+
+  Node *new_leaf();
+  InternalNode *new_internal();
+  void free_node(Node *node) noexcept;  // Releases an emptied node
+  void destroy(Node *node) noexcept;    // Destroys a whole subtree
+  Node *clone(Node *src, InternalNode *parent);  // Deep copy of a subtree
+  void set_child(InternalNode *parent, size_type i, Node *child) noexcept;
+
+  void construct_slot(Node *node, size_type i, value_type &&value);
+  void relocate(Node *dst, size_type di, Node *src,
+                size_type si);  // Moves one element and destroys the source
+  void relocate_range(Node *dst, size_type di, Node *src, size_type si,
+                      size_type n);  // Moves n elements, src and dst may
+                                     // overlap
+
+  // attributes
+  Node *root_;
+  size_type size_;
+  Compare comp_;
+  Allocator alloc_;
+};
+
+// Member functions
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi>::BTree()
+    : BTree(Compare()) {}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi>::BTree(
+    const Compare &compare, const Allocator &alloc)
+    : root_(nullptr), size_(0), comp_(compare), alloc_(alloc) {}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi>::BTree(
+    const BTree &other)
+    : BTree(other.comp_, alloc_traits::select_on_container_copy_construction(
+                             other.alloc_)) {
+  if (other.root_) root_ = clone(other.root_, nullptr);
+  size_ = other.size_;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi>::BTree(
+    BTree &&other) noexcept
+    : root_(other.root_),
+      size_(other.size_),
+      comp_(std::move(other.comp_)),
+      alloc_(std::move(other.alloc_)) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi>::~BTree() {
+  clear();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+BTree<key_type, value_type, Compare, Allocator, Multi> &
+BTree<key_type, value_type, Compare, Allocator, Multi>::operator=(
+    BTree &&other) noexcept {
+  swap(other);
+  return *this;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::allocator_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::get_allocator() const {
+  return alloc_;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::key_compare
+BTree<key_type, value_type, Compare, Allocator, Multi>::key_comp() const {
+  return comp_;
+}
+
+// Iterators
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::begin() noexcept {
+  return root_ ? iterator(leftmost(), 0) : end();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::end() noexcept {
+  return iterator(root_, root_ ? root_->count : 0);
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::begin()
+    const noexcept {
+  return const_cast<BTree *>(this)->begin();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::end() const noexcept {
+  return const_cast<BTree *>(this)->end();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::cbegin()
+    const noexcept {
+  return begin();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::cend() const noexcept {
+  return end();
+}
+
+// Capacity
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+bool BTree<key_type, value_type, Compare, Allocator, Multi>::empty()
+    const noexcept {
+  return size_ == 0;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::size() const noexcept {
+  return size_;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::max_size()
+    const noexcept {
+  return alloc_traits::max_size(alloc_);
+}
+
+// Modifiers
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::clear() noexcept {
+  if (root_) destroy(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+// The returned iterator is normalized from the leaf position remove()
+// tracked; for an element erased from an internal node that position is
+// the predecessor's old slot, one step before the answer.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::erase(iterator pos) {
+  bool internal = !pos.node_->leaf;
+  iterator track = remove(pos.node_, pos.position_);
+  if (track.node_) {
+    while (track.position_ == track.node_->count && track.node_->parent) {
+      track.position_ = track.node_->position;
+      track.node_ = track.node_->parent;
+    }
+    if (internal) ++track;
+  }
+  return track;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::erase(
+    const_iterator pos) {
+  return erase(iterator(pos.node_, pos.position_));
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::erase(
+    const key_type &key) {
+  if constexpr (!Multi) {
+    iterator it = find(key);
+    if (it == end()) return 0;
+    remove(it.node_, it.position_);
+    return 1;
+  }
+  size_type erased = 0;
+  iterator it = lower_bound(key);
+  while (it != end() && !comp_(key, key_of(*it))) {
+    it = erase(it);
+    ++erased;
+  }
+  return erased;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::swap(
+    BTree &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+  std::swap(alloc_, other.alloc_);
+}
+
+// Lookup
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::find(
+    const key_type &key) {
+  if constexpr (Multi) {
+    iterator it = lower_bound(key);
+    return it != end() && !comp_(key, key_of(*it)) ? it : end();
+  } else {
+    for (Node *node = root_; node;) {
+      size_type i = lower_index(node, key);
+      if (i < node->count && !comp_(key, key_of(*node->slot(i)))) {
+        return iterator(node, i);
+      }
+      if (node->leaf) break;
+      node = static_cast<InternalNode *>(node)->children[i];
+    }
+    return end();
+  }
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::find(
+    const key_type &key) const {
+  return const_cast<BTree *>(this)->find(key);
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+bool BTree<key_type, value_type, Compare, Allocator, Multi>::contains(
+    const key_type &key) const {
+  return find(key) != end();
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::count(
+    const key_type &key) const {
+  if constexpr (!Multi) return contains(key) ? 1 : 0;
+  size_type n = 0;
+  for (const_iterator it = lower_bound(key);
+       it != end() && !comp_(key, key_of(*it)); ++it) {
+    ++n;
+  }
+  return n;
+}
+
+// The answer is the separator where the search last turned left, or the
+// position it reaches in a leaf if that holds an element.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::lower_bound(
+    const key_type &key) {
+  iterator result = end();
+  for (Node *node = root_; node;) {
+    size_type i = lower_index(node, key);
+    if (i < node->count) result = iterator(node, i);
+    if (node->leaf) break;
+    node = static_cast<InternalNode *>(node)->children[i];
+  }
+  return result;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::lower_bound(
+    const key_type &key) const {
+  return const_cast<BTree *>(this)->lower_bound(key);
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::upper_bound(
+    const key_type &key) {
+  iterator result = end();
+  for (Node *node = root_; node;) {
+    size_type i = upper_index(node, key);
+    if (i < node->count) result = iterator(node, i);
+    if (node->leaf) break;
+    node = static_cast<InternalNode *>(node)->children[i];
+  }
+  return result;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::const_iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::upper_bound(
+    const key_type &key) const {
+  return const_cast<BTree *>(this)->upper_bound(key);
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+std::pair<
+    typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator,
+    typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator>
+BTree<key_type, value_type, Compare, Allocator, Multi>::equal_range(
+    const key_type &key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+std::pair<typename BTree<key_type, value_type, Compare, Allocator,
+                         Multi>::const_iterator,
+          typename BTree<key_type, value_type, Compare, Allocator,
+                         Multi>::const_iterator>
+BTree<key_type, value_type, Compare, Allocator, Multi>::equal_range(
+    const key_type &key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+// Insertion helpers
+
+// The element is built before the leaf is shifted, so arguments that refer
+// into the tree stay valid.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+template <class... Args>
+std::pair<
+    typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator,
+    bool>
+BTree<key_type, value_type, Compare, Allocator, Multi>::emplace_key(
+    const key_type &key, Args &&...args) {
+  if (!root_) root_ = new_leaf();
+  Node *node = root_;
+  for (;;) {
+    size_type i;
+    if constexpr (Multi) {
+      i = upper_index(node, key);
+    } else {
+      i = lower_index(node, key);
+      if (i < node->count && !comp_(key, key_of(*node->slot(i)))) {
+        return {iterator(node, i), false};
+      }
+    }
+    if (node->leaf) {
+      value_type value(std::forward<Args>(args)...);
+      return {insert_at(node, i, std::move(value)), true};
+    }
+    node = static_cast<InternalNode *>(node)->children[i];
+  }
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+template <class... Args>
+std::pair<
+    typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator,
+    bool>
+BTree<key_type, value_type, Compare, Allocator, Multi>::emplace_value(
+    Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return emplace_key(key_of(value), std::move(value));
+}
+
+// Unique containers keep other's duplicates in other; multi containers take
+// everything.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::merge_from(
+    BTree &other) {
+  if (&other == this) return;
+  BTree rest(other.comp_, other.alloc_);
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    if (!emplace_key(key_of(*it), std::move(*it)).second) {
+      rest.emplace_key(key_of(*it), std::move(*it));
+    }
+  }
+  other = std::move(rest);
+}
+
+// Arithmetic keys are scanned linearly: a node of them spans a few cache
+// lines that the prefetcher streams in, and the loop mispredicts once where
+// a binary search would mispredict at every other step. Other keys halve the
+// range without branching on the comparison, since each comparison may be
+// expensive.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::lower_index(
+    Node *node, const key_type &key) const {
+  size_type n = node->count;
+  const value_type *first = node->slot(0);
+  if constexpr (std::is_arithmetic_v<key_type>) {
+    size_type i = 0;
+    while (i < n && comp_(key_of(first[i]), key)) ++i;
+    return i;
+  } else {
+    if (n == 0) return 0;
+    const value_type *base = first;
+    while (n > 1) {
+      size_type half = n / 2;
+      base = comp_(key_of(base[half - 1]), key) ? base + half : base;
+      n -= half;
+    }
+    return (base - first) + comp_(key_of(*base), key);
+  }
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::size_type
+BTree<key_type, value_type, Compare, Allocator, Multi>::upper_index(
+    Node *node, const key_type &key) const {
+  size_type n = node->count;
+  const value_type *first = node->slot(0);
+  if constexpr (std::is_arithmetic_v<key_type>) {
+    size_type i = 0;
+    while (i < n && !comp_(key, key_of(first[i]))) ++i;
+    return i;
+  } else {
+    if (n == 0) return 0;
+    const value_type *base = first;
+    while (n > 1) {
+      size_type half = n / 2;
+      base = comp_(key, key_of(base[half - 1])) ? base : base + half;
+      n -= half;
+    }
+    return (base - first) + !comp_(key, key_of(*base));
+  }
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::Node *
+BTree<key_type, value_type, Compare, Allocator, Multi>::leftmost() const {
+  Node *node = root_;
+  while (!node->leaf) node = static_cast<InternalNode *>(node)->children[0];
+  return node;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::insert_at(
+    Node *leaf, size_type i, value_type &&value) {
+  constexpr size_type kMiddle = kSlots / 2;
+  if (leaf->count == kSlots) {
+    split(leaf);
+    if (i > kMiddle) {
+      i -= kMiddle + 1;
+      leaf = leaf->parent->children[leaf->position + 1];
+    }
+  }
+  relocate_range(leaf, i + 1, leaf, i, leaf->count - i);
+  try {
+    construct_slot(leaf, i, std::move(value));
+  } catch (...) {
+    relocate_range(leaf, i, leaf, i + 1, leaf->count - i);
+    throw;
+  }
+  ++leaf->count;
+  ++size_;
+  return iterator(leaf, i);
+}
+
+// The middle element moves up into the parent, splitting that first if it
+// is full too; a full root gets a new root above it. Both new nodes are
+// allocated before anything moves, so running out of memory leaves the
+// tree as it was.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::split(
+    Node *node) {
+  constexpr size_type kMiddle = kSlots / 2;
+  Node *right = node->leaf ? new_leaf() : new_internal();
+  InternalNode *parent = node->parent;
+  try {
+    if (!parent) {
+      parent = new_internal();
+      set_child(parent, 0, node);
+      root_ = parent;
+    } else if (parent->count == kSlots) {
+      split(parent);
+      parent = node->parent;
+    }
+  } catch (...) {
+    free_node(right);
+    throw;
+  }
+  size_type moved = kSlots - kMiddle - 1;
+  relocate_range(right, 0, node, kMiddle + 1, moved);
+  right->count = static_cast<unsigned short>(moved);
+  if (!node->leaf) {
+    InternalNode *from = static_cast<InternalNode *>(node);
+    for (size_type c = 0; c <= moved; ++c) {
+      set_child(static_cast<InternalNode *>(right), c,
+                from->children[kMiddle + 1 + c]);
+    }
+  }
+  size_type p = node->position;
+  relocate_range(parent, p + 1, parent, p, parent->count - p);
+  for (size_type c = parent->count + 1; c > p + 1; --c) {
+    set_child(parent, c, parent->children[c - 1]);
+  }
+  relocate(parent, p, node, kMiddle);
+  set_child(parent, p + 1, right);
+  ++parent->count;
+  node->count = static_cast<unsigned short>(kMiddle);
+}
+
+// Removal
+
+// A node below kMinSlots borrows one element through the parent from a
+// sibling that can spare it, or merges with a sibling otherwise, which takes
+// an element from the parent and may leave that short in turn. track is an
+// iterator position inside the tree, possibly one past the end of its node,
+// kept pointing at the same element throughout.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::rebalance(
+    Node *node, iterator &track) {
+  while (node != root_ && node->count < kMinSlots) {
+    InternalNode *parent = node->parent;
+    size_type p = node->position;
+    Node *left = p > 0 ? parent->children[p - 1] : nullptr;
+    Node *right = p < parent->count ? parent->children[p + 1] : nullptr;
+    if (left && left->count > kMinSlots) {
+      rotate_right(left, node, parent, p - 1);
+      if (track.node_ == node) ++track.position_;
+      return;
+    }
+    if (right && right->count > kMinSlots) {
+      rotate_left(node, right, parent, p);
+      return;
+    }
+    if (left) {
+      if (track.node_ == node) {
+        track.node_ = left;
+        track.position_ += left->count + 1;
+      }
+      merge_nodes(left, node, parent, p - 1);
+    } else {
+      merge_nodes(node, right, parent, p);
+    }
+    node = parent;
+  }
+  if (root_->count == 0) {
+    Node *old = root_;
+    if (old->leaf) {
+      root_ = nullptr;
+      track = iterator(nullptr, 0);
+    } else {
+      root_ = static_cast<InternalNode *>(old)->children[0];
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    free_node(old);
+  }
+}
+
+// An element in an internal node is replaced by its predecessor, which
+// always sits at the end of a leaf, so removal itself only ever shifts a
+// leaf. Returns that leaf position, tracked through the rebalancing.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::iterator
+BTree<key_type, value_type, Compare, Allocator, Multi>::remove(Node *node,
+                                                               size_type i) {
+  alloc_traits::destroy(alloc_, node->slot(i));
+  if (!node->leaf) {
+    iterator pred(node, i);
+    --pred;
+    relocate(node, i, pred.node_, pred.position_);
+    node = pred.node_;
+    i = pred.position_;
+  }
+  relocate_range(node, i, node, i + 1, node->count - i - 1);
+  --node->count;
+  --size_;
+  iterator track(node, i);
+  rebalance(node, track);
+  return track;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::rotate_right(
+    Node *left, Node *node, InternalNode *parent, size_type s) {
+  relocate_range(node, 1, node, 0, node->count);
+  relocate(node, 0, parent, s);
+  relocate(parent, s, left, left->count - 1);
+  if (!node->leaf) {
+    InternalNode *to = static_cast<InternalNode *>(node);
+    for (size_type c = node->count + 1; c > 0; --c) {
+      set_child(to, c, to->children[c - 1]);
+    }
+    set_child(to, 0, static_cast<InternalNode *>(left)->children[left->count]);
+  }
+  --left->count;
+  ++node->count;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::rotate_left(
+    Node *node, Node *right, InternalNode *parent, size_type s) {
+  relocate(node, node->count, parent, s);
+  relocate(parent, s, right, 0);
+  relocate_range(right, 0, right, 1, right->count - 1);
+  if (!node->leaf) {
+    InternalNode *from = static_cast<InternalNode *>(right);
+    set_child(static_cast<InternalNode *>(node), node->count + 1,
+              from->children[0]);
+    for (size_type c = 0; c < right->count; ++c) {
+      set_child(from, c, from->children[c + 1]);
+    }
+  }
+  ++node->count;
+  --right->count;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::merge_nodes(
+    Node *left, Node *right, InternalNode *parent, size_type s) {
+  size_type base = left->count;
+  relocate(left, base, parent, s);
+  relocate_range(left, base + 1, right, 0, right->count);
+  if (!left->leaf) {
+    InternalNode *from = static_cast<InternalNode *>(right);
+    for (size_type c = 0; c <= right->count; ++c) {
+      set_child(static_cast<InternalNode *>(left), base + 1 + c,
+                from->children[c]);
+    }
+  }
+  left->count = static_cast<unsigned short>(base + 1 + right->count);
+  relocate_range(parent, s, parent, s + 1, parent->count - s - 1);
+  for (size_type c = s + 1; c < parent->count; ++c) {
+    set_child(parent, c, parent->children[c + 1]);
+  }
+  --parent->count;
+  right->count = 0;
+  free_node(right);
+}
+
+// Storage management
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::Node *
+BTree<key_type, value_type, Compare, Allocator, Multi>::new_leaf() {
+  leaf_allocator alloc(alloc_);
+  Node *node = leaf_traits::allocate(alloc, 1);
+  ::new (static_cast<void *>(node)) Node;
+  node->parent = nullptr;
+  node->position = 0;
+  node->count = 0;
+  node->leaf = true;
+  return node;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::InternalNode *
+BTree<key_type, value_type, Compare, Allocator, Multi>::new_internal() {
+  internal_allocator alloc(alloc_);
+  InternalNode *node = internal_traits::allocate(alloc, 1);
+  ::new (static_cast<void *>(node)) InternalNode;
+  node->parent = nullptr;
+  node->position = 0;
+  node->count = 0;
+  node->leaf = false;
+  return node;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::free_node(
+    Node *node) noexcept {
+  if (node->leaf) {
+    leaf_allocator alloc(alloc_);
+    leaf_traits::deallocate(alloc, node, 1);
+  } else {
+    internal_allocator alloc(alloc_);
+    internal_traits::deallocate(alloc, static_cast<InternalNode *>(node), 1);
+  }
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::destroy(
+    Node *node) noexcept {
+  if (!node->leaf) {
+    InternalNode *internal = static_cast<InternalNode *>(node);
+    for (size_type c = 0; c <= node->count; ++c) destroy(internal->children[c]);
+  }
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (size_type i = 0; i < node->count; ++i) {
+      alloc_traits::destroy(alloc_, node->slot(i));
+    }
+  }
+  free_node(node);
+}
+
+// Copies keep the source's node layout, so a copy costs no comparisons.
+// Children are built before the node's own elements, and whatever was built
+// is released again if a copy throws.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+typename BTree<key_type, value_type, Compare, Allocator, Multi>::Node *
+BTree<key_type, value_type, Compare, Allocator, Multi>::clone(
+    Node *src, InternalNode *parent) {
+  Node *node = src->leaf ? new_leaf() : new_internal();
+  node->parent = parent;
+  node->position = src->position;
+  size_type children = 0;
+  try {
+    if (!src->leaf) {
+      InternalNode *from = static_cast<InternalNode *>(src);
+      InternalNode *to = static_cast<InternalNode *>(node);
+      for (; children <= src->count; ++children) {
+        to->children[children] = clone(from->children[children], to);
+      }
+    }
+    for (; node->count < src->count; ++node->count) {
+      alloc_traits::construct(alloc_, node->slot(node->count),
+                              *src->slot(node->count));
+    }
+  } catch (...) {
+    InternalNode *to = static_cast<InternalNode *>(node);
+    for (size_type c = 0; c < children; ++c) destroy(to->children[c]);
+    for (size_type i = 0; i < node->count; ++i) {
+      alloc_traits::destroy(alloc_, node->slot(i));
+    }
+    free_node(node);
+    throw;
+  }
+  return node;
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::set_child(
+    InternalNode *parent, size_type i, Node *child) noexcept {
+  parent->children[i] = child;
+  child->parent = parent;
+  child->position = static_cast<unsigned short>(i);
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::construct_slot(
+    Node *node, size_type i, value_type &&value) {
+  alloc_traits::construct(alloc_, node->slot(i), std::move(value));
+}
+
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::relocate(
+    Node *dst, size_type di, Node *src, size_type si) {
+  alloc_traits::construct(alloc_, dst->slot(di), std::move(*src->slot(si)));
+  alloc_traits::destroy(alloc_, src->slot(si));
+}
+
+// Trivially copyable elements move with one memmove. Others are moved one
+// at a time, front to back or back to front as the overlap requires.
+template <class key_type, class value_type, class Compare, class Allocator,
+          bool Multi>
+void BTree<key_type, value_type, Compare, Allocator, Multi>::relocate_range(
+    Node *dst, size_type di, Node *src, size_type si, size_type n) {
+  if (n == 0) return;
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(static_cast<void *>(dst->slot(di)), src->slot(si),
+                 n * sizeof(value_type));
+  } else if (dst == src && di > si) {
+    for (size_type k = n; k-- > 0;) relocate(dst, di + k, src, si + k);
+  } else {
+    for (size_type k = 0; k < n; ++k) relocate(dst, di + k, src, si + k);
+  }
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_BTREE_H_
@@ -0,0 +1,14 @@
+#ifndef SRC_MY_CACHE_LINE_H_
+#define SRC_MY_CACHE_LINE_H_
+
+#include <cstddef>
+
+namespace mynamespace {
+
+// Assumed size of a cache line; data written by different threads is kept
+// this far apart to avoid false sharing.
+constexpr size_t kCacheLineSize = 64;
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_CACHE_LINE_H_
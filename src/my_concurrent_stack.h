@@ -0,0 +1,275 @@
+#ifndef SRC_MY_CONCURRENT_STACK_H_
+#define SRC_MY_CONCURRENT_STACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "my_cache_line.h"
+
+namespace mynamespace {
+
+// Lock-free LIFO stack (Treiber) for any number of threads. Nodes are
+// reclaimed with hazard pointers: a thread that is about to dereference the
+// head publishes it in one of the stack's hazard slots first, and a popped
+// node is only deleted once no slot holds it. Because a protected node can
+// never be freed and reallocated, the head CAS cannot suffer from ABA.
+//
+// Popped nodes go to a shared retired list; once it holds more than twice
+// the number of hazard slots, the thread that retired the last node deletes
+// every retired node no slot refers to. A value stays unchanged while its
+// node may still be read, so pop copies copyable values out rather than
+// moving them; move-only values are moved and cannot be read with try_top.
+// At most kHazardSlots threads are inside pop or try_top at the same time;
+// further ones wait for a free slot.
+template <class T>
+class ConcurrentStack {
+ public:
+  static constexpr size_t kHazardSlots = 64;
+
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+
+  // Member functions
+  ConcurrentStack() = default;  // Default constructor
+  ConcurrentStack(const ConcurrentStack &) = delete;
+  ConcurrentStack &operator=(const ConcurrentStack &) = delete;
+  ~ConcurrentStack();  // Destructor
+
+  // Element access
+  bool try_top(value_type &value) const;  // Copies out the top element
+                                          // unless empty
+
+  // Capacity
+  bool empty() const noexcept;  // Checks whether the stack is empty
+
+  // Modifiers
+  void push(const_reference value);  // Inserts element at the top
+  void push(value_type &&value);     // Moves element to the top
+  template <class... Args>
+  void emplace(Args &&...args);     // Constructs element in-place at the top
+  bool pop();                       // Removes the top element unless empty
+  bool try_pop(value_type &value);  // Takes out the top element unless
+                                    // empty
+
+  // Bonus
+
+  template <class... Args>
+  void insert_many_front(
+      Args &&...args);  // Appends new elements to the top of the container
+
+ private:
+  struct Node {
+    template <class... Args>
+    explicit Node(Args &&...args) : value_(std::forward<Args>(args)...) {}
+
+    value_type value_;
+    Node *next_ = nullptr;          // Next node while linked
+    Node *retired_next_ = nullptr;  // Next node on the retired list
+  };
+
+  struct alignas(kCacheLineSize) HazardSlot {
+    std::atomic<bool> active_{false};     // Slot is owned by a thread
+    std::atomic<Node *> hazard_{nullptr};  // Node the owner may read
+  };
+
+  HazardSlot &acquire_slot() const;  // Claims a free hazard slot
+  Node *protect_head(HazardSlot &slot) const;  // Publishes and returns the
+                                               // current head
+  Node *unlink_head();                     // Pops the head node, if any
+  void link(Node *node) noexcept;          // Pushes a node
+  void retire(Node *node);                 // Defers deletion of a node
+  void reclaim();                          // Deletes unprotected nodes
+
+  // attributes
+  alignas(kCacheLineSize) std::atomic<Node *> head_{nullptr};
+  alignas(kCacheLineSize) std::atomic<Node *> retired_{nullptr};
+  std::atomic<size_type> retired_count_{0};
+  mutable HazardSlot slots_[kHazardSlots];
+};
+
+template <class value_type>
+ConcurrentStack<value_type>::~ConcurrentStack() {
+  for (Node *node = head_.load(std::memory_order_relaxed); node;) {
+    Node *next = node->next_;
+    delete node;
+    node = next;
+  }
+  for (Node *node = retired_.load(std::memory_order_relaxed); node;) {
+    Node *next = node->retired_next_;
+    delete node;
+    node = next;
+  }
+}
+
+// Element access
+
+template <class value_type>
+bool ConcurrentStack<value_type>::try_top(value_type &value) const {
+  static_assert(std::is_copy_assignable_v<value_type>,
+                "try_top needs a copyable value_type");
+  HazardSlot &slot = acquire_slot();
+  Node *node = protect_head(slot);
+  if (node) value = node->value_;
+  slot.hazard_.store(nullptr, std::memory_order_release);
+  slot.active_.store(false, std::memory_order_release);
+  return node != nullptr;
+}
+
+// Capacity
+
+template <class value_type>
+bool ConcurrentStack<value_type>::empty() const noexcept {
+  return head_.load(std::memory_order_acquire) == nullptr;
+}
+
+// Modifiers
+
+template <class value_type>
+void ConcurrentStack<value_type>::push(const_reference value) {
+  link(new Node(value));
+}
+
+template <class value_type>
+void ConcurrentStack<value_type>::push(value_type &&value) {
+  link(new Node(std::move(value)));
+}
+
+template <class value_type>
+template <class... Args>
+void ConcurrentStack<value_type>::emplace(Args &&...args) {
+  link(new Node(std::forward<Args>(args)...));
+}
+
+template <class value_type>
+bool ConcurrentStack<value_type>::pop() {
+  Node *node = unlink_head();
+  if (node) retire(node);
+  return node != nullptr;
+}
+
+template <class value_type>
+bool ConcurrentStack<value_type>::try_pop(value_type &value) {
+  Node *node = unlink_head();
+  if (!node) return false;
+  if constexpr (std::is_copy_assignable_v<value_type>) {
+    value = node->value_;
+  } else {
+    value = std::move(node->value_);
+  }
+  retire(node);
+  return true;
+}
+
+template <class value_type>
+template <class... Args>
+void ConcurrentStack<value_type>::insert_many_front(Args &&...args) {
+  (push(std::forward<Args>(args)), ...);
+}
+
+template <class value_type>
+typename ConcurrentStack<value_type>::HazardSlot &
+ConcurrentStack<value_type>::acquire_slot() const {
+  thread_local const size_t hint =
+      std::hash<std::thread::id>()(std::this_thread::get_id());
+  for (size_t i = hint;; ++i) {
+    HazardSlot &slot = slots_[i % kHazardSlots];
+    if (!slot.active_.load(std::memory_order_relaxed) &&
+        !slot.active_.exchange(true, std::memory_order_acquire)) {
+      return slot;
+    }
+    if ((i - hint + 1) % kHazardSlots == 0) std::this_thread::yield();
+  }
+}
+
+template <class value_type>
+typename ConcurrentStack<value_type>::Node *
+ConcurrentStack<value_type>::protect_head(HazardSlot &slot) const {
+  Node *node = head_.load(std::memory_order_acquire);
+  for (;;) {
+    slot.hazard_.store(node, std::memory_order_seq_cst);
+    // The node was not retired before the hazard became visible only if it
+    // is still the head afterwards.
+    Node *current = head_.load(std::memory_order_seq_cst);
+    if (current == node) return node;
+    node = current;
+  }
+}
+
+template <class value_type>
+typename ConcurrentStack<value_type>::Node *
+ConcurrentStack<value_type>::unlink_head() {
+  HazardSlot &slot = acquire_slot();
+  Node *node = protect_head(slot);
+  while (node && !head_.compare_exchange_weak(node, node->next_,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_acquire)) {
+    node = protect_head(slot);
+  }
+  slot.hazard_.store(nullptr, std::memory_order_release);
+  slot.active_.store(false, std::memory_order_release);
+  return node;
+}
+
+template <class value_type>
+void ConcurrentStack<value_type>::link(Node *node) noexcept {
+  node->next_ = head_.load(std::memory_order_relaxed);
+  while (!head_.compare_exchange_weak(node->next_, node,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+template <class value_type>
+void ConcurrentStack<value_type>::retire(Node *node) {
+  node->retired_next_ = retired_.load(std::memory_order_relaxed);
+  while (!retired_.compare_exchange_weak(node->retired_next_, node,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+  if (retired_count_.fetch_add(1, std::memory_order_relaxed) + 1 >=
+      2 * kHazardSlots) {
+    reclaim();
+  }
+}
+
+template <class value_type>
+void ConcurrentStack<value_type>::reclaim() {
+  Node *list = retired_.exchange(nullptr, std::memory_order_acquire);
+  if (!list) return;
+  Node *hazards[kHazardSlots];
+  size_t count = 0;
+  for (const HazardSlot &slot : slots_) {
+    Node *hazard = slot.hazard_.load(std::memory_order_seq_cst);
+    if (hazard) hazards[count++] = hazard;
+  }
+  std::sort(hazards, hazards + count);
+  size_type freed = 0;
+  while (list) {
+    Node *node = list;
+    list = list->retired_next_;
+    if (std::binary_search(hazards, hazards + count, node)) {
+      node->retired_next_ = retired_.load(std::memory_order_relaxed);
+      while (!retired_.compare_exchange_weak(node->retired_next_, node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+      }
+    } else {
+      delete node;
+      ++freed;
+    }
+  }
+  retired_count_.fetch_sub(freed, std::memory_order_relaxed);
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_CONCURRENT_STACK_H_
@@ -1,8 +1,33 @@
 #ifndef SRC_MY_CONTAINERS
 #define SRC_MY_CONTAINERS
 
+#include "my_archive.h"
+#include "my_blocking_queue.h"
+#include "my_btree.h"
+#include "my_concurrent_stack.h"
+#include "my_deque.h"
+#include "my_flat_hash_map.h"
+#include "my_flat_hash_set.h"
+#include "my_hash_table.h"
+#include "my_intrusive_list.h"
 #include "my_list.h"
+#include "my_map.h"
+#include "my_mpmc_queue.h"
+#include "my_multiset.h"
+#include "my_parallel.h"
+#include "my_pool_allocator.h"
+#include "my_priority_queue.h"
 #include "my_queue.h"
+#include "my_ring_queue.h"
+#include "my_set.h"
+#include "my_small_vector.h"
+#include "my_spsc_queue.h"
 #include "my_stack.h"
+#include "my_stats.h"
+#include "my_thread_pool.h"
+#include "my_unrolled_list.h"
+#include "my_vector.h"
+#include "my_views.h"
+#include "my_work_stealing_deque.h"
 
 #endif  // SRC_MY_CONTAINERS
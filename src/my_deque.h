@@ -0,0 +1,691 @@
+#ifndef SRC_MY_DEQUE_H_
+#define SRC_MY_DEQUE_H_
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "my_stats.h"
+
+namespace mynamespace {
+
+// Number of elements per block: a power of two close to 512 bytes, but at
+// least 16 elements.
+template <class T>
+constexpr size_t deque_block_size() {
+  size_t n = sizeof(T) * 16 > 512 ? 16 : 512 / sizeof(T);
+  size_t block = 1;
+  while (block * 2 <= n) block *= 2;
+  return block;
+}
+
+// Double-ended queue built from fixed-size blocks referenced by a block map.
+// Elements never move once constructed; only block pointers are shifted when
+// the map is recentered or grown. A block emptied by a pop is kept as a spare
+// and reused by the next push that needs one.
+template <class T, class Allocator = std::allocator<T>,
+          class Stats = DefaultStats>
+class Deque : private Stats {
+  static constexpr size_t kBlockSize = deque_block_size<T>();
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using map_allocator =
+      typename alloc_traits::template rebind_alloc<T *>;
+  using map_traits = std::allocator_traits<map_allocator>;
+
+  template <class element_type>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = element_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = element_type *;
+    using reference = element_type &;
+
+    const Deque *deque_;
+    size_t index_;
+
+    DequeIterator() : deque_(nullptr), index_(0) {}
+
+    DequeIterator(const Deque *deque, size_t index)
+        : deque_(deque), index_(index){};
+
+    element_type &operator*() const { return deque_->element(index_); };
+
+    element_type *operator->() const { return &deque_->element(index_); }
+
+    element_type &operator[](difference_type n) const {
+      return deque_->element(index_ + n);
+    }
+
+    DequeIterator &operator++() {
+      ++index_;
+      return *this;
+    }
+
+    DequeIterator &operator--() {
+      --index_;
+      return *this;
+    }
+
+    DequeIterator operator++(int) {
+      DequeIterator copy = *this;
+      ++index_;
+      return copy;
+    }
+
+    DequeIterator operator--(int) {
+      DequeIterator copy = *this;
+      --index_;
+      return copy;
+    }
+
+    DequeIterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+
+    DequeIterator &operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(deque_, index_ + n);
+    }
+
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(deque_, index_ - n);
+    }
+
+    friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+      return it + n;
+    }
+
+    difference_type operator-(const DequeIterator &it) const {
+      return static_cast<difference_type>(index_ - it.index_);
+    }
+
+    bool operator==(const DequeIterator &it) const {
+      return index_ == it.index_;
+    };
+
+    bool operator!=(const DequeIterator &it) const {
+      return index_ != it.index_;
+    }
+
+    bool operator<(const DequeIterator &it) const { return index_ < it.index_; }
+
+    bool operator>(const DequeIterator &it) const { return index_ > it.index_; }
+
+    bool operator<=(const DequeIterator &it) const {
+      return index_ <= it.index_;
+    }
+
+    bool operator>=(const DequeIterator &it) const {
+      return index_ >= it.index_;
+    }
+  };
+
+  template <class element_type>
+  class DequeConstIterator : public DequeIterator<element_type> {
+   public:
+    using pointer = const element_type *;
+    using reference = const element_type &;
+    using difference_type = std::ptrdiff_t;
+
+    DequeConstIterator() = default;
+
+    DequeConstIterator(const Deque *deque, size_t index)
+        : DequeIterator<element_type>(deque, index){};
+
+    DequeConstIterator(const DequeIterator<element_type> &it)
+        : DequeIterator<element_type>(it) {}
+
+    const element_type &operator*() const {
+      return this->deque_->element(this->index_);
+    }
+
+    const element_type *operator->() const {
+      return &this->deque_->element(this->index_);
+    }
+
+    const element_type &operator[](difference_type n) const {
+      return this->deque_->element(this->index_ + n);
+    }
+
+    // The arithmetic is repeated so that it yields const iterators
+
+    DequeConstIterator &operator++() {
+      ++this->index_;
+      return *this;
+    }
+
+    DequeConstIterator &operator--() {
+      --this->index_;
+      return *this;
+    }
+
+    DequeConstIterator operator++(int) {
+      DequeConstIterator copy = *this;
+      ++this->index_;
+      return copy;
+    }
+
+    DequeConstIterator operator--(int) {
+      DequeConstIterator copy = *this;
+      --this->index_;
+      return copy;
+    }
+
+    DequeConstIterator &operator+=(difference_type n) {
+      this->index_ += n;
+      return *this;
+    }
+
+    DequeConstIterator &operator-=(difference_type n) {
+      this->index_ -= n;
+      return *this;
+    }
+
+    DequeConstIterator operator+(difference_type n) const {
+      return DequeConstIterator(this->deque_, this->index_ + n);
+    }
+
+    using DequeIterator<element_type>::operator-;
+
+    DequeConstIterator operator-(difference_type n) const {
+      return DequeConstIterator(this->deque_, this->index_ - n);
+    }
+
+    friend DequeConstIterator operator+(difference_type n,
+                                        const DequeConstIterator &it) {
+      return it + n;
+    }
+  };
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using allocator_type = Allocator;  // The type of the element allocator
+  using iterator =
+      DequeIterator<value_type>;  // The type for iterating through the
+                                  // container
+  using const_iterator =
+      DequeConstIterator<value_type>;  // The constant type for iterating
+                                       // through the container
+
+  // Member functions
+  Deque();                                 // Default constructor
+  explicit Deque(const Allocator &alloc);  // Allocator constructor
+  explicit Deque(size_type n);             // Parameterized constructor
+  Deque(std::initializer_list<value_type> const
+            &items);          // Initializer list constructor
+  Deque(const Deque &d);      // Copy constructor
+  Deque(Deque &&d) noexcept;  // Move constructor
+  ~Deque();                   // Destructor
+  Deque &operator=(
+      Deque &&d) noexcept;  // Assignment operator overload for moving object
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+
+  // Element access
+  reference at(size_type pos);  // Access specified element with bounds check
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);  // Access specified element
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;  // Access the first element
+  const_reference back() const;   // Access the last element
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the beginning
+  iterator end() noexcept;    // Returns an iterator to the end
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+  void shrink_to_fit() noexcept;  // Frees the spare block
+
+  // Modifiers
+  void clear() noexcept;  // Clears the contents
+  void push_back(const_reference value);  // Adds an element to the end
+  void push_back(value_type &&value);     // Moves an element to the end
+  template <class... Args>
+  reference emplace_back(
+      Args &&...args);  // Constructs an element in-place at the end
+  void pop_back();      // Removes the last element
+  void push_front(const_reference value);  // Adds an element to the head
+  void push_front(value_type &&value);     // Moves an element to the head
+  template <class... Args>
+  reference emplace_front(
+      Args &&...args);  // Constructs an element in-place at the head
+  void pop_front();     // Removes the first element
+  void swap(Deque &other) noexcept;  // Swaps the contents
+
+  // Bonus
+
+  template <class... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+  template <class... Args>
+  void insert_many_front(
+      Args &&...args);  // Appends new elements to the top of the container
+
+  // Instrumentation
+  ContainerStats stats() const noexcept;  // Returns a snapshot of the
+                                          // counters of the Stats policy
+
+ private:
+  value_type &element(size_type index) const
+      noexcept;  // Element at an index relative to the front
+  value_type *slot(size_type abs) const
+      noexcept;  // Storage at an absolute position in the map
+  void reserve_map(bool at_front);  // Makes room for one more block
+  value_type *acquire_block();      // Takes the spare block or allocates one
+  void release_block(size_type block) noexcept;  // Keeps or frees a block
+  size_type held_bytes() const noexcept;  // Bytes of the map and all blocks
+
+  // attributes
+  Allocator alloc_;
+  value_type **map_;
+  size_type map_size_;
+  size_type start_;  // Absolute position of the first element
+  size_type size_;
+  value_type *spare_;
+};
+
+// Member functions
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque() : Deque(Allocator()) {}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque(const Allocator &alloc)
+    : Stats("Deque"),
+      alloc_(alloc),
+      map_(nullptr),
+      map_size_(0),
+      start_(0),
+      size_(0),
+      spare_(nullptr) {}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque(size_type n) : Deque() {
+  for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque(
+    std::initializer_list<value_type> const &items)
+    : Deque() {
+  for (const auto &item : items) push_back(item);
+}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque(const Deque &d)
+    : Deque(alloc_traits::select_on_container_copy_construction(d.alloc_)) {
+  for (auto it = d.cbegin(); it != d.cend(); ++it) push_back(*it);
+}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::Deque(Deque &&d) noexcept
+    : Stats("Deque"),
+      alloc_(d.alloc_),
+      map_(d.map_),
+      map_size_(d.map_size_),
+      start_(d.start_),
+      size_(d.size_),
+      spare_(d.spare_) {
+  Stats::on_transfer(d, held_bytes());
+  Stats::on_size(size_);
+  d.map_ = nullptr;
+  d.spare_ = nullptr;
+  d.map_size_ = d.start_ = d.size_ = 0;
+}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>::~Deque() {
+  clear();
+  shrink_to_fit();
+  if (map_) {
+    map_allocator map_alloc(alloc_);
+    map_traits::deallocate(map_alloc, map_, map_size_);
+    Stats::on_deallocate(map_size_ * sizeof(value_type *));
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+Deque<value_type, Allocator, Stats>
+    &Deque<value_type, Allocator, Stats>::operator=(Deque &&d) noexcept {
+  swap(d);
+  return *this;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::allocator_type
+Deque<value_type, Allocator, Stats>::get_allocator() const {
+  return alloc_;
+}
+
+// Element access
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::reference
+Deque<value_type, Allocator, Stats>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return element(pos);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_reference
+Deque<value_type, Allocator, Stats>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return element(pos);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::reference
+Deque<value_type, Allocator, Stats>::operator[](size_type pos) {
+  return element(pos);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_reference
+Deque<value_type, Allocator, Stats>::operator[](size_type pos) const {
+  return element(pos);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_reference
+Deque<value_type, Allocator, Stats>::front() const {
+  return *slot(start_);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_reference
+Deque<value_type, Allocator, Stats>::back() const {
+  return *slot(start_ + size_ - 1);
+}
+
+// Iterators
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::iterator
+Deque<value_type, Allocator, Stats>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::iterator
+Deque<value_type, Allocator, Stats>::end() noexcept {
+  return iterator(this, size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_iterator
+Deque<value_type, Allocator, Stats>::cbegin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::const_iterator
+Deque<value_type, Allocator, Stats>::cend() const noexcept {
+  return const_iterator(this, size_);
+}
+
+// Capacity
+
+template <class value_type, class Allocator, class Stats>
+bool Deque<value_type, Allocator, Stats>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::size_type
+Deque<value_type, Allocator, Stats>::size() const noexcept {
+  return size_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::size_type
+Deque<value_type, Allocator, Stats>::max_size() const noexcept {
+  return alloc_traits::max_size(alloc_);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::shrink_to_fit() noexcept {
+  if (spare_) {
+    alloc_traits::deallocate(alloc_, spare_, kBlockSize);
+    Stats::on_deallocate(kBlockSize * sizeof(value_type));
+    spare_ = nullptr;
+  }
+}
+
+// Modifiers
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::clear() noexcept {
+  while (size_ > 0) pop_back();
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename Deque<value_type, Allocator, Stats>::reference
+Deque<value_type, Allocator, Stats>::emplace_back(Args &&...args) {
+  if ((start_ + size_) / kBlockSize >= map_size_) reserve_map(false);
+  size_type abs = start_ + size_;
+  value_type *&block = map_[abs / kBlockSize];
+  bool fresh = block == nullptr;
+  if (fresh) block = acquire_block();
+  try {
+    alloc_traits::construct(alloc_, block + abs % kBlockSize,
+                            std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) release_block(abs / kBlockSize);
+    throw;
+  }
+  Stats::on_size(++size_);
+  return block[abs % kBlockSize];
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::pop_back() {
+  if (size_ > 0) {
+    size_type abs = start_ + --size_;
+    alloc_traits::destroy(alloc_, slot(abs));
+    if (size_ == 0 || abs % kBlockSize == 0) release_block(abs / kBlockSize);
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename Deque<value_type, Allocator, Stats>::reference
+Deque<value_type, Allocator, Stats>::emplace_front(Args &&...args) {
+  if (start_ == 0) reserve_map(true);
+  size_type abs = start_ - 1;
+  value_type *&block = map_[abs / kBlockSize];
+  bool fresh = block == nullptr;
+  if (fresh) block = acquire_block();
+  try {
+    alloc_traits::construct(alloc_, block + abs % kBlockSize,
+                            std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) release_block(abs / kBlockSize);
+    throw;
+  }
+  --start_;
+  Stats::on_size(++size_);
+  return block[abs % kBlockSize];
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::pop_front() {
+  if (size_ > 0) {
+    size_type abs = start_++;
+    --size_;
+    alloc_traits::destroy(alloc_, slot(abs));
+    if (size_ == 0 || start_ % kBlockSize == 0) {
+      release_block(abs / kBlockSize);
+    }
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::swap(Deque &other) noexcept {
+  Stats::on_transfer(other, other.held_bytes());
+  other.Stats::on_transfer(*this, held_bytes());
+  std::swap(alloc_, other.alloc_);
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+  Stats::on_size(size_);
+  other.Stats::on_size(other.size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+void Deque<value_type, Allocator, Stats>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+void Deque<value_type, Allocator, Stats>::insert_many_front(Args &&...args) {
+  size_type n = sizeof...(Args);
+  (emplace_front(std::forward<Args>(args)), ...);
+  for (iterator first = begin(), last = begin() + n; first < last;) {
+    --last;
+    std::swap(*first, *last);
+    ++first;
+  }
+}
+
+// Instrumentation
+
+template <class value_type, class Allocator, class Stats>
+ContainerStats Deque<value_type, Allocator, Stats>::stats() const noexcept {
+  return Stats::snapshot();
+}
+
+// Block management
+
+template <class value_type, class Allocator, class Stats>
+value_type &Deque<value_type, Allocator, Stats>::element(
+    size_type index) const noexcept {
+  return *slot(start_ + index);
+}
+
+template <class value_type, class Allocator, class Stats>
+value_type *Deque<value_type, Allocator, Stats>::slot(
+    size_type abs) const noexcept {
+  return map_[abs / kBlockSize] + abs % kBlockSize;
+}
+
+// Moves the used block pointers to the middle of the map, growing it first
+// when fewer than half of its entries would stay free.
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::reserve_map(bool at_front) {
+  size_type first = start_ / kBlockSize;
+  size_type used = 0;
+  if (size_ > 0) used = (start_ + size_ - 1) / kBlockSize - first + 1;
+  size_type needed = used + 1;
+  size_type new_size = map_size_;
+  value_type **map = map_;
+  if (map_size_ < 2 * needed) {
+    new_size = map_size_ * 2 > 2 * needed ? map_size_ * 2 : 2 * needed + 6;
+    map_allocator map_alloc(alloc_);
+    map = map_traits::allocate(map_alloc, new_size);
+    Stats::on_allocate(new_size * sizeof(value_type *));
+  }
+  size_type new_first = (new_size - needed) / 2 + (at_front ? 1 : 0);
+  if (used > 0) {
+    std::memmove(map + new_first, map_ + first, used * sizeof(value_type *));
+  }
+  for (size_type i = 0; i < new_size; ++i) {
+    if (i < new_first || i >= new_first + used) map[i] = nullptr;
+  }
+  if (map != map_) {
+    if (map_) {
+      map_allocator map_alloc(alloc_);
+      map_traits::deallocate(map_alloc, map_, map_size_);
+      Stats::on_deallocate(map_size_ * sizeof(value_type *));
+    }
+    map_ = map;
+    map_size_ = new_size;
+  }
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <class value_type, class Allocator, class Stats>
+value_type *Deque<value_type, Allocator, Stats>::acquire_block() {
+  if (spare_) {
+    value_type *block = spare_;
+    spare_ = nullptr;
+    return block;
+  }
+  value_type *block = alloc_traits::allocate(alloc_, kBlockSize);
+  Stats::on_allocate(kBlockSize * sizeof(value_type));
+  return block;
+}
+
+template <class value_type, class Allocator, class Stats>
+void Deque<value_type, Allocator, Stats>::release_block(
+    size_type block) noexcept {
+  if (spare_) {
+    alloc_traits::deallocate(alloc_, map_[block], kBlockSize);
+    Stats::on_deallocate(kBlockSize * sizeof(value_type));
+  } else {
+    spare_ = map_[block];
+  }
+  map_[block] = nullptr;
+}
+
+// Counts the blocks holding elements from the positions of the first and last
+// one, plus the spare.
+template <class value_type, class Allocator, class Stats>
+typename Deque<value_type, Allocator, Stats>::size_type
+Deque<value_type, Allocator, Stats>::held_bytes() const noexcept {
+  size_type blocks = spare_ ? 1 : 0;
+  if (size_ > 0) {
+    blocks += (start_ + size_ - 1) / kBlockSize - start_ / kBlockSize + 1;
+  }
+  return map_size_ * sizeof(value_type *) +
+         blocks * kBlockSize * sizeof(value_type);
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_DEQUE_H_
@@ -0,0 +1,198 @@
+#ifndef SRC_MY_FLAT_HASH_MAP_H_
+#define SRC_MY_FLAT_HASH_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "my_hash_table.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Unordered map from unique keys to values, stored inline in an
+// open-addressing table instead of one node per element. Elements are
+// std::pair<const Key, T> as in std::unordered_map; moving one to a new
+// table copies its key. With a Hash and KeyEqual that declare
+// is_transparent, find, contains and count accept any type they can hash
+// and compare, such as a std::string_view or a C string for std::string
+// keys.
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class FlatHashMap : private HashTable<Key, std::pair<const Key, T>, Hash,
+                                      KeyEqual, Allocator> {
+  using table =
+      HashTable<Key, std::pair<const Key, T>, Hash, KeyEqual, Allocator>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Member types
+  using key_type = Key;    // The type of a key
+  using mapped_type = T;   // The type of a value
+  using value_type =
+      std::pair<const key_type, mapped_type>;  // The type of an element
+  using reference =
+      value_type &;  // The type of the reference to an element
+  using const_reference =
+      const value_type &;  // The type of the constant reference to an element
+  using iterator =
+      typename table::iterator;  // The type for iterating through the
+                                 // container, in no particular order
+  using const_iterator =
+      typename table::const_iterator;  // The constant type for iterating
+                                       // through the container
+  using size_type = size_t;            // The type of the container size
+  using hasher = Hash;                 // The type of the key hash
+  using key_equal = KeyEqual;          // The type of the key equality
+  using allocator_type = Allocator;    // The type of the element allocator
+
+  // Member functions
+  FlatHashMap() {}  // Default constructor
+
+  explicit FlatHashMap(size_type bucket_count, const Hash &hash = Hash(),
+                       const KeyEqual &equal = KeyEqual(),
+                       const Allocator &alloc = Allocator())
+      : table(bucket_count, hash, equal, alloc) {}  // Bucket count
+                                                    // constructor
+
+  FlatHashMap(std::initializer_list<value_type> const &items) {
+    table::reserve(items.size());
+    for (const auto &item : items) insert(item);
+  }  // Initializer list constructor
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  FlatHashMap(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }  // Range constructor
+
+  FlatHashMap(const FlatHashMap &m) : table(m) {}  // Copy constructor
+
+  FlatHashMap(FlatHashMap &&m) noexcept
+      : table(std::move(m)) {}  // Move constructor
+
+  ~FlatHashMap() {}  // Destructor
+
+  FlatHashMap &operator=(FlatHashMap &&m) noexcept {
+    table::operator=(std::move(m));
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  using table::get_allocator;
+  using table::hash_function;
+  using table::key_eq;
+
+  // Element access
+
+  T &at(const Key &key) {
+    iterator it = table::find(key);
+    if (it == table::end()) throw std::out_of_range("Key not found");
+    return it->second;
+  }  // Access specified element with bounds check
+
+  const T &at(const Key &key) const {
+    const_iterator it = table::find(key);
+    if (it == table::end()) throw std::out_of_range("Key not found");
+    return it->second;
+  }
+
+  T &operator[](const Key &key) {
+    return table::emplace_key(key, std::piecewise_construct,
+                              std::forward_as_tuple(key), std::tuple<>())
+        .first->second;
+  }  // Access or insert specified element
+
+  // Iterators
+
+  using table::begin;
+  using table::cbegin;
+  using table::cend;
+  using table::end;
+
+  // Capacity
+
+  using table::empty;
+  using table::max_size;
+  using table::size;
+
+  // Modifiers
+
+  using table::clear;
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table::emplace_key(value.first, value);
+  }  // Inserts value unless its key is present
+
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return table::emplace_key(key, key, obj);
+  }  // Inserts the pair unless key is present
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> result = table::emplace_key(key, key, obj);
+    if (!result.second) result.first->second = obj;
+    return result;
+  }  // Inserts the pair or assigns obj to the present key
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table::emplace_value(std::forward<Args>(args)...);
+  }  // Constructs the pair in-place and inserts it if the key is new
+
+  iterator erase(const_iterator pos) {
+    return table::erase(pos);
+  }  // Erases element at pos and returns the iterator to the next one
+
+  iterator erase(iterator pos) { return table::erase(pos); }
+
+  size_type erase(const key_type &key) {
+    return table::erase(key);
+  }  // Erases key and returns the number of erased elements
+
+  void swap(FlatHashMap &other) noexcept {
+    table::swap(other);
+  }  // Swaps the contents
+
+  void merge(FlatHashMap &other) {
+    table::merge_from(other);
+  }  // Moves over the elements of other whose keys are not yet present
+
+  // Lookup
+
+  using table::contains;
+  using table::count;
+  using table::find;
+
+  // Hash policy
+
+  using table::bucket_count;
+  using table::load_factor;
+  using table::max_load_factor;
+  using table::rehash;
+  using table::reserve;
+
+  // Bonus
+
+  template <class... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    table::reserve(size() + sizeof...(Args));
+    Vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (const value_type &item : items) result.push_back(insert(item));
+    return result;
+  }  // Inserts new elements; room for all of them is reserved first, so
+     // every result stays valid
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_FLAT_HASH_MAP_H_
@@ -0,0 +1,180 @@
+#ifndef SRC_MY_FLAT_HASH_SET_H_
+#define SRC_MY_FLAT_HASH_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "my_hash_table.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Unordered set of unique keys, stored inline in an open-addressing table.
+// Keys cannot be modified in place, so iterator and const_iterator are the
+// same type. With a Hash and KeyEqual that declare is_transparent, find,
+// contains and count accept any type they can hash and compare.
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class FlatHashSet : private HashTable<Key, Key, Hash, KeyEqual, Allocator> {
+  using table = HashTable<Key, Key, Hash, KeyEqual, Allocator>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+  template <class H, class E>
+  using RequireTransparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  // Member types
+  using key_type = Key;    // The type of a key
+  using value_type = Key;  // The type of an element
+  using reference =
+      value_type &;  // The type of the reference to an element
+  using const_reference =
+      const value_type &;  // The type of the constant reference to an element
+  using iterator =
+      typename table::const_iterator;  // The type for iterating through the
+                                       // container, in no particular order
+  using const_iterator =
+      typename table::const_iterator;  // The constant type for iterating
+                                       // through the container
+  using size_type = size_t;            // The type of the container size
+  using hasher = Hash;                 // The type of the key hash
+  using key_equal = KeyEqual;          // The type of the key equality
+  using allocator_type = Allocator;    // The type of the element allocator
+
+  // Member functions
+  FlatHashSet() {}  // Default constructor
+
+  explicit FlatHashSet(size_type bucket_count, const Hash &hash = Hash(),
+                       const KeyEqual &equal = KeyEqual(),
+                       const Allocator &alloc = Allocator())
+      : table(bucket_count, hash, equal, alloc) {}  // Bucket count
+                                                    // constructor
+
+  FlatHashSet(std::initializer_list<value_type> const &items) {
+    table::reserve(items.size());
+    for (const auto &item : items) insert(item);
+  }  // Initializer list constructor
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  FlatHashSet(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }  // Range constructor
+
+  FlatHashSet(const FlatHashSet &s) : table(s) {}  // Copy constructor
+
+  FlatHashSet(FlatHashSet &&s) noexcept
+      : table(std::move(s)) {}  // Move constructor
+
+  ~FlatHashSet() {}  // Destructor
+
+  FlatHashSet &operator=(FlatHashSet &&s) noexcept {
+    table::operator=(std::move(s));
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  using table::get_allocator;
+  using table::hash_function;
+  using table::key_eq;
+
+  // Iterators
+
+  iterator begin() const noexcept {
+    return table::cbegin();
+  }  // Returns an iterator to the first key
+
+  iterator end() const noexcept {
+    return table::cend();
+  }  // Returns an iterator past the last key
+
+  using table::cbegin;
+  using table::cend;
+
+  // Capacity
+
+  using table::empty;
+  using table::max_size;
+  using table::size;
+
+  // Modifiers
+
+  using table::clear;
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table::emplace_key(value, value);
+  }  // Inserts value unless an equal key is present
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table::emplace_key(value, std::move(value));
+  }  // Moves value in unless an equal key is present
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table::emplace_value(std::forward<Args>(args)...);
+  }  // Constructs the key in-place and inserts it if it is new
+
+  iterator erase(iterator pos) {
+    return table::erase(pos);
+  }  // Erases element at pos and returns the iterator to the next one
+
+  size_type erase(const key_type &key) {
+    return table::erase(key);
+  }  // Erases key and returns the number of erased elements
+
+  void swap(FlatHashSet &other) noexcept {
+    table::swap(other);
+  }  // Swaps the contents
+
+  void merge(FlatHashSet &other) {
+    table::merge_from(other);
+  }  // Moves over the keys of other not yet present here
+
+  // Lookup
+
+  iterator find(const key_type &key) const {
+    return table::find(key);
+  }  // Finds key
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = RequireTransparent<H, E>>
+  iterator find(const K &key) const {
+    return table::find(key);
+  }  // Finds a key equal to key, without converting key to key_type
+
+  using table::contains;
+  using table::count;
+
+  // Hash policy
+
+  using table::bucket_count;
+  using table::load_factor;
+  using table::max_load_factor;
+  using table::rehash;
+  using table::reserve;
+
+  // Bonus
+
+  template <class... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    table::reserve(size() + sizeof...(Args));
+    Vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (const value_type &item : items) result.push_back(insert(item));
+    return result;
+  }  // Inserts new elements; room for all of them is reserved first, so
+     // every result stays valid
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_FLAT_HASH_SET_H_
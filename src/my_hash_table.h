@@ -0,0 +1,936 @@
+#ifndef SRC_MY_HASH_TABLE_H_
+#define SRC_MY_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace mynamespace {
+
+// Open-addressing storage shared by FlatHashMap and FlatHashSet. Elements
+// live directly in one array of slots, next to an array with one control
+// byte per slot: a full slot's byte holds seven bits of its element's hash
+// (H2), a free one is kEmpty or the tombstone kDeleted. The slots form
+// groups of kGroupWidth, and a lookup starts at the group picked by the
+// rest of the hash (H1). It compares H2 against a whole group's control
+// bytes at once (one SSE2 compare where available) and only calls KeyEqual
+// for the candidates that match. It ends at the first group with an empty
+// slot, visiting further groups in triangular steps.
+//
+// Erasing leaves a tombstone only if the slot's group has no empty slot,
+// since only then can a probe have passed through the group. The table
+// grows once empty slots would fall below one in eight. Growing and rehash
+// invalidate iterators; other inserts and erases leave the iterators to
+// other elements valid. Value is Key for sets and
+// std::pair<const Key, T> for maps.
+template <class Key, class Value, class Hash, class KeyEqual, class Allocator>
+class HashTable {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using ctrl_t = signed char;
+
+  static constexpr ctrl_t kEmpty = -128;   // Never held an element
+  static constexpr ctrl_t kDeleted = -2;   // Held an element a probe may
+                                           // have passed
+  static constexpr ctrl_t kSentinel = -1;  // Ends iteration after the last
+                                           // slot
+
+ public:
+  // Member types
+  using key_type = Key;      // The type of a key
+  using value_type = Value;  // The type of an element
+  using reference = Value &;  // The type of the reference to an element
+  using const_reference =
+      const Value &;  // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using difference_type = std::ptrdiff_t;  // The type of iterator distances
+  using hasher = Hash;                     // The type of the key hash
+  using key_equal = KeyEqual;              // The type of the key equality
+  using allocator_type = Allocator;        // The type of the element allocator
+
+  static constexpr size_type kGroupWidth = 16;  // Slots probed at once
+
+ private:
+  static constexpr size_type kBlockAlign =
+      std::max(kGroupWidth, alignof(Value));
+
+  // The unit of the allocation holding the control bytes and the slots.
+  struct alignas(kBlockAlign) Block {
+    unsigned char bytes[kBlockAlign];
+  };
+
+  using block_allocator = typename alloc_traits::template rebind_alloc<Block>;
+  using block_traits = std::allocator_traits<block_allocator>;
+
+  // The control bytes of one group, queried as bitmasks with bit i set for
+  // slot i of the group.
+  class Group {
+   public:
+    explicit Group(const ctrl_t *ctrl) {
+#ifdef __SSE2__
+      ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+      std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+    }
+
+    uint32_t match(ctrl_t h2) const {
+#ifdef __SSE2__
+      return static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+      uint32_t mask = 0;
+      for (size_type i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+      }
+      return mask;
+#endif
+    }  // Full slots whose hash has this H2
+
+    uint32_t match_empty() const { return match(kEmpty); }
+
+    uint32_t match_free() const {
+#ifdef __SSE2__
+      return static_cast<uint32_t>(_mm_movemask_epi8(
+          _mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_)));
+#else
+      uint32_t mask = 0;
+      for (size_type i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] < kSentinel) << i;
+      }
+      return mask;
+#endif
+    }  // Empty slots and tombstones
+
+    uint32_t count_leading_free() const {
+      return static_cast<uint32_t>(__builtin_ctz(~match_free()));
+    }  // Free slots before the first full slot or the sentinel
+
+   private:
+#ifdef __SSE2__
+    __m128i ctrl_;
+#else
+    ctrl_t ctrl_[kGroupWidth];
+#endif
+  };
+
+  template <class Element>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Element>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Element *;
+    using reference = Element &;
+
+    Iterator() : ctrl_(nullptr), slot_(nullptr) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Element> &&
+                               !std::is_same_v<Other, Element>>>
+    Iterator(const Iterator<Other> &it)
+        : ctrl_(it.ctrl_), slot_(it.slot_) {}  // Converts iterator into
+                                               // const_iterator
+
+    reference operator*() const { return *slot_; }
+    pointer operator->() const { return slot_; }
+
+    Iterator &operator++() {
+      ++ctrl_;
+      ++slot_;
+      skip_free();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return ctrl_ == other.ctrl_;
+    }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    friend class HashTable;
+    template <class>
+    friend class Iterator;
+
+    Iterator(const ctrl_t *ctrl, Value *slot) : ctrl_(ctrl), slot_(slot) {}
+
+    // Jumps over a whole run of free slots per group load. The sentinel
+    // group after the last slot stops the scan at end().
+    void skip_free() {
+      while (*ctrl_ < kSentinel) {
+        uint32_t shift = Group(ctrl_).count_leading_free();
+        ctrl_ += shift;
+        slot_ += shift;
+      }
+    }
+
+    const ctrl_t *ctrl_;
+    Value *slot_;
+  };
+
+  template <class H, class E>
+  using RequireTransparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  using iterator = Iterator<Value>;  // Forward, in slot order
+  using const_iterator = Iterator<const Value>;
+
+  // Member functions
+  HashTable();  // Default constructor
+  explicit HashTable(size_type bucket_count, const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual(),
+                     const Allocator &alloc = Allocator());  // Sizes the
+                                                             // table for
+                                                             // bucket_count
+                                                             // slots
+  HashTable(const HashTable &other);      // Copy constructor, same layout
+  HashTable(HashTable &&other) noexcept;  // Move constructor
+  ~HashTable();                           // Destructor
+  HashTable &operator=(HashTable &&other) noexcept;  // Assignment operator
+                                                     // overload for moving
+                                                     // object
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+  hasher hash_function() const;          // Returns the key hash
+  key_equal key_eq() const;              // Returns the key equality
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the first element
+  iterator end() noexcept;    // Returns an iterator past the last one
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+
+  // Modifiers
+  void clear() noexcept;  // Clears the contents, keeping the slots
+  iterator erase(iterator pos);  // Erases element at pos and returns the
+                                 // iterator to the next one
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);  // Erases the element with key
+  void swap(HashTable &other) noexcept;  // Swaps the contents
+
+  // Lookup
+  iterator find(const key_type &key);  // Finds the element with key
+  const_iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;  // Checks whether there is an
+                                             // element with key
+  size_type count(
+      const key_type &key) const;  // Returns the number of elements with key
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = RequireTransparent<H, E>>
+  iterator find(const K &key) {
+    size_type i = find_index(key, hash_of(key));
+    return iterator(ctrl_ + i, slots_ + i);
+  }  // Finds an element whose key equals key, without converting key to
+     // key_type; needs Hash and KeyEqual with is_transparent
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = RequireTransparent<H, E>>
+  const_iterator find(const K &key) const {
+    return const_cast<HashTable *>(this)->find(key);
+  }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = RequireTransparent<H, E>>
+  bool contains(const K &key) const {
+    return find(key) != end();
+  }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = RequireTransparent<H, E>>
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Hash policy
+  size_type bucket_count() const noexcept;  // Returns the number of slots
+  float load_factor() const noexcept;       // Returns size / bucket_count
+  float max_load_factor()
+      const noexcept;  // Returns the load factor at which the table grows
+  void rehash(size_type count);  // Rebuilds the table with at least count
+                                 // slots, dropping tombstones
+  void reserve(size_type count);  // Makes room for count elements without
+                                  // growing again
+
+ protected:
+  static const key_type &key_of(const value_type &value) {
+    if constexpr (std::is_same_v<key_type, value_type>) {
+      return value;
+    } else {
+      return value.first;
+    }
+  }  // The key part of an element
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace_key(
+      const key_type &key,
+      Args &&...args);  // Inserts value_type(args...) unless key is present
+  template <class... Args>
+  std::pair<iterator, bool> emplace_value(
+      Args &&...args);  // Constructs the element first to find its key
+  void merge_from(HashTable &other);  // Moves over the elements whose keys
+                                      // are not yet present
+
+ private:
+  template <class K>
+  size_t hash_of(const K &key) const;  // Hash mixed so every bit counts
+  static ctrl_t h2(size_t hash) {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+  static size_type max_load(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+  static size_type capacity_for(size_type count);  // Smallest capacity that
+                                                   // holds count elements
+
+  template <class K>
+  size_type find_index(const K &key,
+                       size_t hash) const;  // Slot holding key, or
+                                            // capacity_ if there is none
+  size_type find_free(size_t hash) const;  // First free slot on the probe
+                                           // sequence of hash
+  iterator insert_at(size_type i, size_t hash);  // Marks slot i full
+  void erase_at(size_type i);  // Destroys the element in slot i
+  void grow();  // Doubles the capacity, or only drops tombstones when they
+                // take up most of the room
+  void resize(size_type capacity);  // Moves every element into a new table
+  static size_type ctrl_bytes(size_type capacity) {
+    return (capacity + kGroupWidth + kBlockAlign - 1) / kBlockAlign *
+           kBlockAlign;
+  }  // Control bytes and sentinel group, padded to align the slots
+  static size_type blocks(size_type capacity) {
+    return (ctrl_bytes(capacity) + capacity * sizeof(Value) + kBlockAlign -
+            1) /
+           kBlockAlign;
+  }
+  void allocate(size_type capacity, ctrl_t *&ctrl, value_type *&slots);
+  void deallocate(ctrl_t *ctrl, size_type capacity) noexcept;
+  void destroy() noexcept;  // Destroys the elements and frees the storage
+
+  // attributes
+  ctrl_t *ctrl_;  // capacity_ control bytes followed by a sentinel group
+  value_type *slots_;
+  size_type capacity_;     // Zero or a power of two, at least kGroupWidth
+  size_type size_;
+  size_type growth_left_;  // Inserts into empty slots left before growing
+  Hash hash_;
+  KeyEqual equal_;
+  Allocator alloc_;
+};
+
+// Member functions
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::HashTable()
+    : HashTable(0) {}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::HashTable(
+    size_type bucket_count, const Hash &hash, const KeyEqual &equal,
+    const Allocator &alloc)
+    : ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      hash_(hash),
+      equal_(equal),
+      alloc_(alloc) {
+  if (bucket_count) rehash(bucket_count);
+}
+
+// Copies keep the source's layout, so a copy hashes nothing.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::HashTable(
+    const HashTable &other)
+    : HashTable(0, other.hash_, other.equal_,
+                alloc_traits::select_on_container_copy_construction(
+                    other.alloc_)) {
+  if (other.size_ == 0) return;
+  ctrl_t *ctrl;
+  value_type *slots;
+  allocate(other.capacity_, ctrl, slots);
+  size_type i = 0;
+  try {
+    for (; i < other.capacity_; ++i) {
+      if (other.ctrl_[i] >= 0) {
+        alloc_traits::construct(alloc_, slots + i, other.slots_[i]);
+      }
+    }
+  } catch (...) {
+    while (i-- > 0) {
+      if (other.ctrl_[i] >= 0) alloc_traits::destroy(alloc_, slots + i);
+    }
+    deallocate(ctrl, other.capacity_);
+    throw;
+  }
+  std::memcpy(ctrl, other.ctrl_, other.capacity_);
+  ctrl_ = ctrl;
+  slots_ = slots;
+  capacity_ = other.capacity_;
+  size_ = other.size_;
+  growth_left_ = other.growth_left_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::HashTable(
+    HashTable &&other) noexcept
+    : ctrl_(other.ctrl_),
+      slots_(other.slots_),
+      capacity_(other.capacity_),
+      size_(other.size_),
+      growth_left_(other.growth_left_),
+      hash_(std::move(other.hash_)),
+      equal_(std::move(other.equal_)),
+      alloc_(std::move(other.alloc_)) {
+  other.ctrl_ = nullptr;
+  other.slots_ = nullptr;
+  other.capacity_ = 0;
+  other.size_ = 0;
+  other.growth_left_ = 0;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::~HashTable() {
+  destroy();
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator> &
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::operator=(
+    HashTable &&other) noexcept {
+  swap(other);
+  return *this;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::allocator_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::get_allocator()
+    const {
+  return alloc_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::hasher
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::hash_function()
+    const {
+  return hash_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::key_equal
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::key_eq() const {
+  return equal_;
+}
+
+// Iterators
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::begin() noexcept {
+  if (size_ == 0) return end();
+  iterator it(ctrl_, slots_);
+  it.skip_free();
+  return it;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::end() noexcept {
+  return iterator(ctrl_ + capacity_, slots_ + capacity_);
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::const_iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::begin()
+    const noexcept {
+  return const_cast<HashTable *>(this)->begin();
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::const_iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::end()
+    const noexcept {
+  return const_cast<HashTable *>(this)->end();
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::const_iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::cbegin()
+    const noexcept {
+  return begin();
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::const_iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::cend()
+    const noexcept {
+  return end();
+}
+
+// Capacity
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+bool HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::empty()
+    const noexcept {
+  return size_ == 0;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size()
+    const noexcept {
+  return size_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::max_size()
+    const noexcept {
+  return max_load(alloc_traits::max_size(alloc_));
+}
+
+// Modifiers
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual,
+               Allocator>::clear() noexcept {
+  if (capacity_ == 0) return;
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) alloc_traits::destroy(alloc_, slots_ + i);
+    }
+  }
+  std::memset(ctrl_, kEmpty, capacity_);
+  size_ = 0;
+  growth_left_ = max_load(capacity_);
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::erase(
+    iterator pos) {
+  erase_at(static_cast<size_type>(pos.ctrl_ - ctrl_));
+  return ++pos;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::erase(
+    const_iterator pos) {
+  return erase(iterator(pos.ctrl_, const_cast<value_type *>(pos.slot_)));
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::erase(
+    const key_type &key) {
+  size_type i = find_index(key, hash_of(key));
+  if (i == capacity_) return 0;
+  erase_at(i);
+  return 1;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::swap(
+    HashTable &other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+  std::swap(alloc_, other.alloc_);
+}
+
+// Lookup
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::find(
+    const key_type &key) {
+  size_type i = find_index(key, hash_of(key));
+  return iterator(ctrl_ + i, slots_ + i);
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual,
+                   Allocator>::const_iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::find(
+    const key_type &key) const {
+  return const_cast<HashTable *>(this)->find(key);
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+bool HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::contains(
+    const key_type &key) const {
+  return find_index(key, hash_of(key)) != capacity_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::count(
+    const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+// Hash policy
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::bucket_count()
+    const noexcept {
+  return capacity_;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+float HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::load_factor()
+    const noexcept {
+  return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+float HashTable<key_type, value_type, Hash, KeyEqual,
+                Allocator>::max_load_factor() const noexcept {
+  return 0.875f;
+}
+
+// A count of zero shrinks the table to fit its elements, and frees it
+// entirely if there are none.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::rehash(
+    size_type count) {
+  size_type capacity = capacity_for(size_);
+  if (count) {
+    size_type requested = kGroupWidth;
+    while (requested < count) requested *= 2;
+    capacity = std::max(capacity, requested);
+  }
+  if (capacity == 0) {
+    destroy();
+  } else {
+    resize(capacity);
+  }
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  if (count > size_ + growth_left_) {
+    resize(std::max(capacity_, capacity_for(count)));
+  }
+}
+
+// Insertion helpers
+
+// If the table has to grow, the element is built before the old slots are
+// released, so arguments that refer into the table stay valid.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+template <class... Args>
+std::pair<
+    typename HashTable<key_type, value_type, Hash, KeyEqual,
+                       Allocator>::iterator,
+    bool>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::emplace_key(
+    const key_type &key, Args &&...args) {
+  size_t hash = hash_of(key);
+  size_type i = find_index(key, hash);
+  if (i != capacity_) return {iterator(ctrl_ + i, slots_ + i), false};
+  if (capacity_) {
+    i = find_free(hash);
+    if (growth_left_ || ctrl_[i] == kDeleted) {
+      alloc_traits::construct(alloc_, slots_ + i, std::forward<Args>(args)...);
+      return {insert_at(i, hash), true};
+    }
+  }
+  value_type value(std::forward<Args>(args)...);
+  grow();
+  i = find_free(hash);
+  alloc_traits::construct(alloc_, slots_ + i, std::move(value));
+  return {insert_at(i, hash), true};
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+template <class... Args>
+std::pair<
+    typename HashTable<key_type, value_type, Hash, KeyEqual,
+                       Allocator>::iterator,
+    bool>
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::emplace_value(
+    Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return emplace_key(key_of(value), std::move(value));
+}
+
+// Elements whose keys are already present stay in other.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::merge_from(
+    HashTable &other) {
+  if (&other == this) return;
+  for (iterator it = other.begin(); it != other.end();) {
+    if (emplace_key(key_of(*it), std::move(*it)).second) {
+      it = other.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+// Private helpers
+
+// Multiplies into 128 bits and folds the halves, so a hash that only varies
+// in a few bits, such as std::hash of an integer, still spreads over both
+// H1 and H2.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+template <class K>
+size_t HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::hash_of(
+    const K &key) const {
+  uint64_t hash = static_cast<uint64_t>(hash_(key));
+#ifdef __SIZEOF_INT128__
+  __uint128_t product =
+      static_cast<__uint128_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(static_cast<uint64_t>(product) ^
+                             static_cast<uint64_t>(product >> 64));
+#else
+  hash *= 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(hash ^ (hash >> 32));
+#endif
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::capacity_for(
+    size_type count) {
+  if (count == 0) return 0;
+  size_type capacity = kGroupWidth;
+  while (max_load(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+// Probes group by group; the number of groups is a power of two, so the
+// triangular steps reach every group. The table always keeps some empty
+// slots, which ends every miss.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+template <class K>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::find_index(
+    const K &key, size_t hash) const {
+  if (size_ == 0) return capacity_;
+  size_type mask = capacity_ / kGroupWidth - 1;
+  size_type group = (hash >> 7) & mask;
+  ctrl_t tag = h2(hash);
+  for (size_type step = 1;; ++step) {
+    size_type first = group * kGroupWidth;
+    Group g(ctrl_ + first);
+    for (uint32_t match = g.match(tag); match; match &= match - 1) {
+      size_type i = first + static_cast<size_type>(__builtin_ctz(match));
+      if (equal_(key_of(slots_[i]), key)) return i;
+    }
+    if (g.match_empty()) return capacity_;
+    group = (group + step) & mask;
+  }
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::size_type
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::find_free(
+    size_t hash) const {
+  size_type mask = capacity_ / kGroupWidth - 1;
+  size_type group = (hash >> 7) & mask;
+  for (size_type step = 1;; ++step) {
+    size_type first = group * kGroupWidth;
+    uint32_t free = Group(ctrl_ + first).match_free();
+    if (free) return first + static_cast<size_type>(__builtin_ctz(free));
+    group = (group + step) & mask;
+  }
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::iterator
+HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::insert_at(
+    size_type i, size_t hash) {
+  if (ctrl_[i] == kEmpty) --growth_left_;
+  ctrl_[i] = h2(hash);
+  ++size_;
+  return iterator(ctrl_ + i, slots_ + i);
+}
+
+// A group with an empty slot ends every probe that reaches it, so no probe
+// relies on this slot having been full and it can be empty again.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::erase_at(
+    size_type i) {
+  alloc_traits::destroy(alloc_, slots_ + i);
+  --size_;
+  if (Group(ctrl_ + (i & ~(kGroupWidth - 1))).match_empty()) {
+    ctrl_[i] = kEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[i] = kDeleted;
+  }
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::grow() {
+  if (capacity_ && size_ <= max_load(capacity_) / 2) {
+    resize(capacity_);
+  } else {
+    resize(capacity_ ? capacity_ * 2 : kGroupWidth);
+  }
+}
+
+// Elements are moved when that cannot throw and copied otherwise; the old
+// slots are released only once every element has been transferred, so a
+// throwing copy leaves the table as it was.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::resize(
+    size_type capacity) {
+  ctrl_t *old_ctrl = ctrl_;
+  value_type *old_slots = slots_;
+  size_type old_capacity = capacity_;
+  allocate(capacity, ctrl_, slots_);
+  capacity_ = capacity;
+  size_type i = 0;
+  try {
+    for (; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0) continue;
+      size_t hash = hash_of(key_of(old_slots[i]));
+      size_type j = find_free(hash);
+      if constexpr (std::is_trivially_copyable<value_type>::value) {
+        std::memcpy(static_cast<void *>(slots_ + j), old_slots + i,
+                    sizeof(value_type));
+      } else {
+        alloc_traits::construct(alloc_, slots_ + j,
+                                std::move_if_noexcept(old_slots[i]));
+      }
+      ctrl_[j] = h2(hash);
+    }
+  } catch (...) {
+    for (size_type j = 0; j < capacity_; ++j) {
+      if (ctrl_[j] >= 0) alloc_traits::destroy(alloc_, slots_ + j);
+    }
+    deallocate(ctrl_, capacity_);
+    ctrl_ = old_ctrl;
+    slots_ = old_slots;
+    capacity_ = old_capacity;
+    throw;
+  }
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] >= 0) alloc_traits::destroy(alloc_, old_slots + i);
+    }
+  }
+  if (old_capacity) deallocate(old_ctrl, old_capacity);
+  growth_left_ = max_load(capacity_) - size_;
+}
+
+// The control bytes and the slots share one allocation: capacity bytes,
+// the sentinel group, then the slots.
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::allocate(
+    size_type capacity, ctrl_t *&ctrl, value_type *&slots) {
+  block_allocator alloc(alloc_);
+  Block *storage = block_traits::allocate(alloc, blocks(capacity));
+  ctrl = reinterpret_cast<ctrl_t *>(storage->bytes);
+  std::memset(ctrl, kEmpty, capacity);
+  std::memset(ctrl + capacity, kSentinel, kGroupWidth);
+  slots = reinterpret_cast<value_type *>(ctrl + ctrl_bytes(capacity));
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual, Allocator>::deallocate(
+    ctrl_t *ctrl, size_type capacity) noexcept {
+  block_allocator alloc(alloc_);
+  block_traits::deallocate(alloc, reinterpret_cast<Block *>(ctrl),
+                           blocks(capacity));
+}
+
+template <class key_type, class value_type, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<key_type, value_type, Hash, KeyEqual,
+               Allocator>::destroy() noexcept {
+  clear();
+  if (capacity_) deallocate(ctrl_, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  growth_left_ = 0;
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_HASH_TABLE_H_
@@ -0,0 +1,629 @@
+#ifndef SRC_MY_INTRUSIVE_LIST_H_
+#define SRC_MY_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mynamespace {
+
+// Links embedded in an object so that IntrusiveList can chain it without a
+// node of its own. A hook belongs to at most one list at a time and is
+// unlinked (both pointers null) otherwise.
+class IntrusiveListHook {
+ public:
+  IntrusiveListHook() noexcept : prev_(nullptr), next_(nullptr) {}
+  IntrusiveListHook(const IntrusiveListHook &) noexcept
+      : IntrusiveListHook() {}  // A copied object starts unlinked
+  IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept {
+    return *this;
+  }  // Links stay with the object, not with its value
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  template <class T, IntrusiveListHook T::*Hook>
+  friend class IntrusiveList;
+
+  IntrusiveListHook *prev_;
+  IntrusiveListHook *next_;
+};
+
+// Doubly linked list of objects the caller owns, chained through the hook
+// member Hook of T. Nothing is allocated or copied: push_back links the
+// object itself and erase unlinks it in O(1) given just a reference. The
+// list never destroys objects; clear and the destructor only unlink them, and
+// an object has to be erased before it is destroyed or moved in memory.
+//
+// The API follows List, with modifiers taking references to the objects to
+// link, so an IntrusiveList can back Queue and Stack.
+template <class T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+  template <class Value>
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    explicit Iterator(IntrusiveListHook *it) : it_(it) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Value> &&
+                               !std::is_same_v<Other, Value>>>
+    Iterator(const Iterator<Other> &it)
+        : it_(it.it_) {}  // Converts iterator into const_iterator
+
+    reference operator*() const { return *owner_of(it_); }
+    pointer operator->() const { return owner_of(it_); }
+
+    Iterator &operator++() {
+      it_ = it_->next_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator old = *this;
+      it_ = it_->next_;
+      return old;
+    }
+
+    Iterator &operator--() {
+      it_ = it_->prev_;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      Iterator old = *this;
+      it_ = it_->prev_;
+      return old;
+    }
+
+    bool operator==(const Iterator &it) const { return it_ == it.it_; }
+    bool operator!=(const Iterator &it) const { return it_ != it.it_; }
+
+    IntrusiveListHook *it_;
+  };
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using iterator =
+      Iterator<T>;  // The type for iterating through the container
+  using const_iterator =
+      Iterator<const T>;  // The constant type for iterating through the
+                          // container
+
+  // Member functions
+  IntrusiveList() noexcept;                   // Default constructor
+  IntrusiveList(const IntrusiveList &) = delete;
+  IntrusiveList(IntrusiveList &&l) noexcept;  // Move constructor
+  ~IntrusiveList();                           // Destructor
+  IntrusiveList &operator=(
+      IntrusiveList &&l) noexcept;  // Assignment operator overload for moving
+                                    // object
+
+  // Element access
+  reference front();              // Access the first element
+  const_reference front() const;  // Access the first element
+  reference back();               // Access the last element
+  const_reference back() const;   // Access the last element
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the beginning
+  iterator end() noexcept;    // Returns an iterator to the end
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+  iterator iterator_to(
+      reference value) noexcept;  // Returns an iterator to a linked object
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+
+  // Modifiers
+  void clear() noexcept;  // Unlinks every element
+  iterator insert(const_iterator pos,
+                  reference value);  // Links value before pos and returns
+                                     // the iterator that points to it
+  iterator erase(const_iterator pos) noexcept;  // Unlinks element at pos,
+                                                // returns the next one
+  void erase(reference value) noexcept;  // Unlinks a linked object in O(1)
+  void push_back(reference value);       // Links an element at the end
+  reference emplace_back(reference value);  // Links an element at the end
+  void pop_back() noexcept;                 // Unlinks the last element
+  void push_front(reference value);         // Links an element at the head
+  reference emplace_front(reference value);  // Links an element at the head
+  void pop_front() noexcept;                 // Unlinks the first element
+  void swap(IntrusiveList &other) noexcept;  // Swaps the contents
+  void merge(IntrusiveList &other);          // Merges two sorted lists
+  template <class Compare>
+  void merge(IntrusiveList &other,
+             Compare comp);  // Merges two lists sorted with respect to comp
+  void splice(const_iterator pos,
+              IntrusiveList &other) noexcept;  // Transfers all of other
+                                               // before pos
+  void splice(const_iterator pos, IntrusiveList &other,
+              const_iterator it) noexcept;  // Transfers the element at it
+                                            // before pos
+  void splice(const_iterator pos, IntrusiveList &other, const_iterator first,
+              const_iterator last) noexcept;  // Transfers [first, last)
+                                              // before pos
+  void reverse() noexcept;  // Reverses the order of the elements
+  void unique();            // Unlinks consecutive duplicate elements
+  void sort();              // Sorts the elements
+  template <class Compare>
+  void sort(Compare comp);  // Sorts the elements using comp
+
+  // Bonus
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos,
+                       Args &...args);  // Links objects directly before pos
+  template <class... Args>
+  void insert_many_back(Args &...args);  // Links objects at the end
+  template <class... Args>
+  void insert_many_front(Args &...args);  // Links objects at the head
+
+ private:
+  static T *owner_of(IntrusiveListHook *hook) noexcept;  // Object of a hook
+  static std::ptrdiff_t hook_offset() noexcept;  // Position of Hook in T
+  static IntrusiveListHook *hook_of(reference value) noexcept {
+    return &(value.*Hook);
+  }
+  void link_before(IntrusiveListHook *pos,
+                   IntrusiveListHook *p);  // Links a detached hook before pos
+  void unlink(IntrusiveListHook *p) noexcept;  // Detaches and resets a hook
+  void take_nodes(IntrusiveList &other) noexcept;  // Steals the chain of
+                                                   // other
+  static void transfer(IntrusiveListHook *pos, IntrusiveListHook *first,
+                       IntrusiveListHook *last) noexcept;  // Moves
+                                                           // [first, last)
+                                                           // before pos
+  void relink(IntrusiveListHook *first) noexcept;  // Rebuilds the ring from
+                                                   // a chain
+  template <class Compare>
+  static IntrusiveListHook *merge_chains(
+      IntrusiveListHook *a, IntrusiveListHook *b,
+      Compare &comp);  // Stably merges two sorted null-terminated chains
+
+  // attributes
+  size_type size_;
+  IntrusiveListHook fake_node_;
+};
+
+// Member functions
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+IntrusiveList<value_type, Hook>::IntrusiveList() noexcept : size_(0) {
+  fake_node_.prev_ = fake_node_.next_ = &fake_node_;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+IntrusiveList<value_type, Hook>::IntrusiveList(IntrusiveList &&l) noexcept
+    : IntrusiveList() {
+  take_nodes(l);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+IntrusiveList<value_type, Hook>::~IntrusiveList() {
+  clear();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+IntrusiveList<value_type, Hook> &IntrusiveList<value_type, Hook>::operator=(
+    IntrusiveList &&l) noexcept {
+  if (this != &l) {
+    clear();
+    take_nodes(l);
+  }
+  return *this;
+}
+
+// Element access
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::reference
+IntrusiveList<value_type, Hook>::front() {
+  return *begin();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_reference
+IntrusiveList<value_type, Hook>::front() const {
+  return *cbegin();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::reference
+IntrusiveList<value_type, Hook>::back() {
+  return *owner_of(fake_node_.prev_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_reference
+IntrusiveList<value_type, Hook>::back() const {
+  return *owner_of(fake_node_.prev_);
+}
+
+// Iterators
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::begin() noexcept {
+  return iterator(fake_node_.next_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::end() noexcept {
+  return iterator(&fake_node_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_iterator
+IntrusiveList<value_type, Hook>::begin() const noexcept {
+  return cbegin();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_iterator
+IntrusiveList<value_type, Hook>::end() const noexcept {
+  return cend();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_iterator
+IntrusiveList<value_type, Hook>::cbegin() const noexcept {
+  return const_iterator(fake_node_.next_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::const_iterator
+IntrusiveList<value_type, Hook>::cend() const noexcept {
+  return const_iterator(const_cast<IntrusiveListHook *>(&fake_node_));
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::iterator_to(reference value) noexcept {
+  return iterator(hook_of(value));
+}
+
+// Capacity
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+bool IntrusiveList<value_type, Hook>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::size_type
+IntrusiveList<value_type, Hook>::size() const noexcept {
+  return size_;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::size_type
+IntrusiveList<value_type, Hook>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max();
+}
+
+// Modifiers
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::clear() noexcept {
+  while (size_ > 0) pop_back();
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::insert(const_iterator pos,
+                                        reference value) {
+  link_before(pos.it_, hook_of(value));
+  return iterator(hook_of(value));
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::erase(const_iterator pos) noexcept {
+  IntrusiveListHook *next = pos.it_->next_;
+  unlink(pos.it_);
+  return iterator(next);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::erase(reference value) noexcept {
+  unlink(hook_of(value));
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::push_back(reference value) {
+  link_before(&fake_node_, hook_of(value));
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::reference
+IntrusiveList<value_type, Hook>::emplace_back(reference value) {
+  push_back(value);
+  return value;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::pop_back() noexcept {
+  if (size_ > 0) unlink(fake_node_.prev_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::push_front(reference value) {
+  link_before(fake_node_.next_, hook_of(value));
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+typename IntrusiveList<value_type, Hook>::reference
+IntrusiveList<value_type, Hook>::emplace_front(reference value) {
+  push_front(value);
+  return value;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::pop_front() noexcept {
+  if (size_ > 0) unlink(fake_node_.next_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::swap(IntrusiveList &other) noexcept {
+  IntrusiveList temp;
+  temp.take_nodes(*this);
+  take_nodes(other);
+  other.take_nodes(temp);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::merge(IntrusiveList &other) {
+  merge(other, std::less<value_type>());
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class Compare>
+void IntrusiveList<value_type, Hook>::merge(IntrusiveList &other,
+                                            Compare comp) {
+  if (this == &other || other.empty()) return;
+  fake_node_.prev_->next_ = nullptr;
+  other.fake_node_.prev_->next_ = nullptr;
+  IntrusiveListHook *first = size_ > 0 ? fake_node_.next_ : nullptr;
+  relink(merge_chains(first, other.fake_node_.next_, comp));
+  size_ += other.size_;
+  other.fake_node_.next_ = other.fake_node_.prev_ = &other.fake_node_;
+  other.size_ = 0;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::splice(const_iterator pos,
+                                             IntrusiveList &other) noexcept {
+  if (this == &other || other.empty()) return;
+  transfer(pos.it_, other.fake_node_.next_, &other.fake_node_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::splice(const_iterator pos,
+                                             IntrusiveList &other,
+                                             const_iterator it) noexcept {
+  if (pos.it_ == it.it_ || pos.it_ == it.it_->next_) return;
+  transfer(pos.it_, it.it_, it.it_->next_);
+  ++size_;
+  --other.size_;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::splice(const_iterator pos,
+                                             IntrusiveList &other,
+                                             const_iterator first,
+                                             const_iterator last) noexcept {
+  if (first == last) return;
+  if (this != &other) {
+    size_type n = 0;
+    for (IntrusiveListHook *p = first.it_; p != last.it_; p = p->next_) ++n;
+    size_ += n;
+    other.size_ -= n;
+  }
+  transfer(pos.it_, first.it_, last.it_);
+}
+
+// Swaps the links of every hook, sentinel included, which turns the ring
+// around without touching the objects.
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::reverse() noexcept {
+  IntrusiveListHook *p = &fake_node_;
+  do {
+    std::swap(p->prev_, p->next_);
+    p = p->prev_;
+  } while (p != &fake_node_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::unique() {
+  if (size_ < 2) return;
+  IntrusiveListHook *p = fake_node_.next_;
+  while (p->next_ != &fake_node_) {
+    if (*owner_of(p) == *owner_of(p->next_)) {
+      unlink(p->next_);
+    } else {
+      p = p->next_;
+    }
+  }
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::sort() {
+  sort(std::less<value_type>());
+}
+
+// Bottom-up merge sort, as in List: bins[i] holds a sorted run of 2^i hooks
+// linked through next_ only; prev_ is rebuilt at the end.
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class Compare>
+void IntrusiveList<value_type, Hook>::sort(Compare comp) {
+  if (size_ < 2) return;
+  IntrusiveListHook *bins[std::numeric_limits<size_type>::digits] = {};
+  size_type filled = 0;
+  fake_node_.prev_->next_ = nullptr;
+  for (IntrusiveListHook *p = fake_node_.next_; p;) {
+    IntrusiveListHook *carry = p;
+    p = p->next_;
+    carry->next_ = nullptr;
+    size_type i = 0;
+    for (; i < filled && bins[i]; ++i) {
+      carry = merge_chains(bins[i], carry, comp);
+      bins[i] = nullptr;
+    }
+    bins[i] = carry;
+    if (i == filled) ++filled;
+  }
+  IntrusiveListHook *result = nullptr;
+  for (size_type i = 0; i < filled; ++i) {
+    if (bins[i]) result = merge_chains(bins[i], result, comp);
+  }
+  relink(result);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class... Args>
+typename IntrusiveList<value_type, Hook>::iterator
+IntrusiveList<value_type, Hook>::insert_many(const_iterator pos,
+                                             Args &...args) {
+  (insert(pos, args), ...);
+  return iterator(pos.it_);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class... Args>
+void IntrusiveList<value_type, Hook>::insert_many_back(Args &...args) {
+  insert_many(cend(), args...);
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class... Args>
+void IntrusiveList<value_type, Hook>::insert_many_front(Args &...args) {
+  insert_many(cbegin(), args...);
+}
+
+// Hook management
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+value_type *IntrusiveList<value_type, Hook>::owner_of(
+    IntrusiveListHook *hook) noexcept {
+  return reinterpret_cast<value_type *>(reinterpret_cast<char *>(hook) -
+                                        hook_offset());
+}
+
+// Where Hook sits inside value_type, measured on suitably aligned storage
+// that never holds an object; the compiler folds it into a constant.
+template <class value_type, IntrusiveListHook value_type::*Hook>
+std::ptrdiff_t IntrusiveList<value_type, Hook>::hook_offset() noexcept {
+  alignas(value_type) static unsigned char probe[sizeof(value_type)];
+  value_type *object = reinterpret_cast<value_type *>(probe);
+  return reinterpret_cast<unsigned char *>(&(object->*Hook)) - probe;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::link_before(IntrusiveListHook *pos,
+                                                  IntrusiveListHook *p) {
+  if (p->is_linked()) {
+    throw std::invalid_argument("IntrusiveList: object is already linked");
+  }
+  p->prev_ = pos->prev_;
+  p->next_ = pos;
+  pos->prev_->next_ = p;
+  pos->prev_ = p;
+  ++size_;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::unlink(IntrusiveListHook *p) noexcept {
+  p->prev_->next_ = p->next_;
+  p->next_->prev_ = p->prev_;
+  p->prev_ = p->next_ = nullptr;
+  --size_;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::take_nodes(
+    IntrusiveList &other) noexcept {
+  if (other.size_ > 0) {
+    fake_node_.next_ = other.fake_node_.next_;
+    fake_node_.prev_ = other.fake_node_.prev_;
+    fake_node_.next_->prev_ = &fake_node_;
+    fake_node_.prev_->next_ = &fake_node_;
+    size_ = other.size_;
+    other.fake_node_.next_ = other.fake_node_.prev_ = &other.fake_node_;
+    other.size_ = 0;
+  }
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::transfer(
+    IntrusiveListHook *pos, IntrusiveListHook *first,
+    IntrusiveListHook *last) noexcept {
+  if (first == last || pos == first || pos == last) return;
+  IntrusiveListHook *before = first->prev_;
+  IntrusiveListHook *tail = last->prev_;
+  before->next_ = last;
+  last->prev_ = before;
+  first->prev_ = pos->prev_;
+  tail->next_ = pos;
+  pos->prev_->next_ = first;
+  pos->prev_ = tail;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+void IntrusiveList<value_type, Hook>::relink(
+    IntrusiveListHook *first) noexcept {
+  IntrusiveListHook *prev = &fake_node_;
+  for (IntrusiveListHook *p = first; p; p = p->next_) {
+    prev->next_ = p;
+    p->prev_ = prev;
+    prev = p;
+  }
+  prev->next_ = &fake_node_;
+  fake_node_.prev_ = prev;
+}
+
+template <class value_type, IntrusiveListHook value_type::*Hook>
+template <class Compare>
+IntrusiveListHook *IntrusiveList<value_type, Hook>::merge_chains(
+    IntrusiveListHook *a, IntrusiveListHook *b, Compare &comp) {
+  IntrusiveListHook head;
+  IntrusiveListHook *tail = &head;
+  while (a && b) {
+    if (comp(*owner_of(b), *owner_of(a))) {
+      tail->next_ = b;
+      b = b->next_;
+    } else {
+      tail->next_ = a;
+      a = a->next_;
+    }
+    tail = tail->next_;
+  }
+  tail->next_ = a ? a : b;
+  return head.next_;
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_INTRUSIVE_LIST_H_
@@ -1,33 +1,62 @@
 #ifndef SRC_MY_LIST_H_
 #define SRC_MY_LIST_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "my_archive.h"
+#include "my_stats.h"
 
 namespace mynamespace {
 
-template <class T>
-class List {
+template <class T, class Allocator = std::allocator<T>,
+          class Stats = DefaultStats>
+class List : private Stats {
+  class NodeBase {
+   public:
+    NodeBase *prev_;
+    NodeBase *next_;
+
+    NodeBase(NodeBase *prev = nullptr, NodeBase *next = nullptr)
+        : prev_(prev), next_(next) {}
+  };
+
   template <class value_type>
-  class Node {
+  class Node : public NodeBase {
    public:
     value_type value_;
-    Node *prev_;
-    Node *next_;
 
-    Node(value_type value = value_type(), Node *prev = nullptr,
-         Node *next = nullptr)
-        : value_(value), prev_(prev), next_(next) {}
+    template <class... Args>
+    explicit Node(Args &&...args)
+        : NodeBase(), value_(std::forward<Args>(args)...) {}
   };
 
-  template <class value_type>
+  template <class element_type>
   class ListIterator {
    public:
-    Node<value_type> *it_;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = element_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = element_type *;
+    using reference = element_type &;
+
+    NodeBase *it_;
 
-    explicit ListIterator(Node<value_type> *it) : it_(it){};
+    explicit ListIterator(NodeBase *it) : it_(it){};
 
-    const value_type &operator*() const { return it_->value_; };
+    element_type &operator*() const {
+      return static_cast<Node<element_type> *>(it_)->value_;
+    };
 
     ListIterator &operator++() {
       it_ = it_->next_;
@@ -39,23 +68,42 @@ class List {
       return *this;
     }
 
-    bool operator==(const ListIterator &it) const { return it_ = it.it_; };
+    bool operator==(const ListIterator &it) const { return it_ == it.it_; };
 
     bool operator!=(const ListIterator &it) const { return it_ != it.it_; }
   };
 
-  template <class value_type>
-  class ListConstIterator : public ListIterator<value_type> {
+  template <class element_type>
+  class ListConstIterator : public ListIterator<element_type> {
    public:
-    explicit ListConstIterator(Node<value_type> *it)
-        : ListIterator<value_type>(it){};
+    using pointer = const element_type *;
+    using reference = const element_type &;
+
+    explicit ListConstIterator(NodeBase *it)
+        : ListIterator<element_type>(it){};
 
     ListConstIterator(const ListConstIterator &it)
-        : ListIterator<value_type>(it) {}
+        : ListIterator<element_type>(it) {}
+    ListConstIterator &operator=(const ListConstIterator &) = default;
+
+    ListConstIterator(const ListIterator<element_type> &it)
+        : ListIterator<element_type>(it) {}  // Converts iterator into
+                                             // const_iterator
 
-    const value_type &operator*() const { return this->it_->value_; }
+    const element_type &operator*() const {
+      return static_cast<Node<element_type> *>(this->it_)->value_;
+    }
   };
 
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node<T>>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
  public:
   // Member types
   using value_type = T;   // The type of an element
@@ -63,6 +111,7 @@ class List {
   using const_reference =
       const T &;             // The type of the constant reference to an element
   using size_type = size_t;  // The type of the container size
+  using allocator_type = Allocator;  // The type of the element allocator
   using iterator =
       ListIterator<value_type>;  // The type for iterating through the container
   using const_iterator =
@@ -70,16 +119,31 @@ class List {
                                       // the container
 
   // Member functions
-  List();                      // Default constructor
-  explicit List(size_type n);  // Parameterized constructor
+  List();                                    // Default constructor
+  explicit List(const Allocator &alloc);     // Allocator constructor
+  explicit List(size_type n);                // Parameterized constructor
+  List(size_type n, const_reference value,
+       const Allocator &alloc = Allocator());  // Constructs n copies of value
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  List(InputIt first, InputIt last,
+       const Allocator &alloc = Allocator());  // Range constructor
   List(std::initializer_list<value_type> const
-           &items);                 // Initializer list constructor
-  List(const List<value_type> &l);  // Copy constructor
-  List(List &&l);                   // Move constructor
-  ~List();                          // Destructor
+           &items);     // Initializer list constructor
+  List(const List &l);  // Copy constructor
+  List(List &&l);       // Move constructor
+  ~List();              // Destructor
   List &operator=(
       List &&l) noexcept;  // Assignment operator overload for moving object
 
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  void assign(InputIt first,
+              InputIt last);  // Replaces the contents with [first, last)
+  void assign(size_type n,
+              const_reference value);  // Replaces the contents with n copies
+                                       // of value
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+
   // Element access
   const_reference front() const;  // Access the first element
   const_reference back() const;   // Access the last element
@@ -102,19 +166,47 @@ class List {
       iterator pos,
       const_reference value);  // Inserts element into concrete pos and returns
                                // the iterator that points to the new element
-  void erase(iterator pos);    // Erases element at pos
+  iterator insert(iterator pos,
+                  value_type &&value);  // Moves element into concrete pos
+  iterator insert(const_iterator pos, size_type n,
+                  const_reference value);  // Inserts n copies of value
+                                           // before pos
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first,
+                  InputIt last);  // Inserts [first, last) before pos
+  template <class... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // Constructs element in-place before pos
+  void erase(iterator pos);          // Erases element at pos
   void push_back(const_reference value);   // Adds an element to the end
-  void pop_back();                         // Removes the last element
+  void push_back(value_type &&value);      // Moves an element to the end
+  template <class... Args>
+  reference emplace_back(
+      Args &&...args);  // Constructs an element in-place at the end
+  void pop_back();      // Removes the last element
   void push_front(const_reference value);  // Adds an element to the head
+  void push_front(value_type &&value);     // Moves an element to the head
+  template <class... Args>
+  reference emplace_front(
+      Args &&...args);  // Constructs an element in-place at the head
   void pop_front();                        // Removes the first element
   void swap(List &other) noexcept;         // Swaps the contents
   void merge(List &other);                 // Merges two sorted lists
+  template <class Compare>
+  void merge(List &other,
+             Compare comp);  // Merges two lists sorted with respect to comp
   void splice(
       const_iterator pos,
       List &other);  // Transfers elements from list other starting from pos
+  void splice(const_iterator pos, List &other,
+              const_iterator it);  // Transfers the element at it before pos
+  void splice(const_iterator pos, List &other, const_iterator first,
+              const_iterator last);  // Transfers [first, last) before pos
   void reverse() noexcept;  // Reverses the order of the elements
   void unique();            // Removes consecutive duplicate elements
-  void sort();              // Sorts the elements
+  void sort();  // Sorts the elements; arithmetic ones are radix sorted
+  template <class Compare>
+  void sort(Compare comp);  // Sorts the elements using comp
 
   // Bonus
 
@@ -129,271 +221,828 @@ class List {
   void insert_many_front(
       Args &&...args);  // Appends new elements to the top of the container
 
+  // Serialization
+  void save(const std::string &path)
+      const;  // Writes the elements to an archive at path
+  void load(const std::string &path);  // Replaces the elements with those
+                                       // of the archive at path
+
+  // Instrumentation
+  ContainerStats stats() const noexcept;  // Returns a snapshot of the
+                                          // counters of the Stats policy
+
  private:
+  // Nodes built off the list and linked in with a single splice, so a bulk
+  // insert touches the ring and the counters once. Nodes still held when
+  // the chain goes out of scope, after an exception, are destroyed and the
+  // list is left as it was.
+  class Chain {
+   public:
+    explicit Chain(List &list) : list_(list), tail_(&head_), size_(0) {}
+    Chain(const Chain &) = delete;
+    Chain &operator=(const Chain &) = delete;
+    ~Chain() {
+      while (tail_ != &head_) {
+        NodeBase *prev = tail_->prev_;
+        list_.destroy_node(tail_);
+        tail_ = prev;
+      }
+    }
+
+    template <class... Args>
+    void append(Args &&...args) {
+      NodeBase *p = list_.create_node(std::forward<Args>(args)...);
+      p->prev_ = tail_;
+      tail_->next_ = p;
+      tail_ = p;
+      ++size_;
+    }  // Adds a node at the end of the chain
+
+    iterator attach(NodeBase *pos) noexcept {
+      if (size_ == 0) return iterator(pos);
+      NodeBase *first = head_.next_;
+      first->prev_ = pos->prev_;
+      pos->prev_->next_ = first;
+      tail_->next_ = pos;
+      pos->prev_ = tail_;
+      list_.size_ += size_;
+      list_.Stats::on_call(StatsOp::kInsert, size_);
+      list_.Stats::on_size(list_.size_);
+      tail_ = &head_;
+      size_ = 0;
+      return iterator(first);
+    }  // Links the whole chain before pos of the list
+
+   private:
+    List &list_;
+    NodeBase head_;
+    NodeBase *tail_;
+    size_type size_;
+  };
+
+  template <class... Args>
+  Node<value_type> *create_node(
+      Args &&...args);  // Allocates and constructs a detached node
+  void destroy_node(NodeBase *p) noexcept;  // Destroys and frees a node
+  void link_before(NodeBase *pos,
+                   NodeBase *p) noexcept;  // Links a detached node before pos
+  NodeBase *unlink(NodeBase *p) noexcept;  // Detaches a node from the chain
+  void take_nodes(List &other) noexcept;   // Steals the chain of other
+  void adopt(List &other,
+             size_type n) noexcept;  // Accounts for n nodes relinked from
+                                     // other
+  bool same_allocator(const List &other)
+      const noexcept;  // Checks whether nodes of other can be adopted as is
+  static void transfer(NodeBase *pos, NodeBase *first,
+                       NodeBase *last) noexcept;  // Moves [first, last)
+                                                  // before pos
+  void copy_transfer(NodeBase *pos, List &other, NodeBase *first,
+                     NodeBase *last);  // Recreates [first, last) of other
+                                       // before pos with own allocator
+  void relink(NodeBase *first) noexcept;  // Rebuilds the ring from a chain
+  template <class Compare>
+  static NodeBase *merge_chains(
+      NodeBase *a, NodeBase *b,
+      Compare &comp);  // Stably merges two sorted null-terminated chains
+  static const_reference value_of(
+      const NodeBase *p) noexcept;  // Access the element of a node
+
+  static constexpr bool kRadixSortable =
+      std::is_arithmetic<T>::value && sizeof(T) <= 8;
+  static constexpr size_type kRadixMinSize = 64;  // Shorter lists are merge
+                                                  // sorted even if
+                                                  // kRadixSortable
+  static constexpr unsigned kRadixBits = 8;       // Bits sorted per pass
+  using radix_key = std::conditional_t<sizeof(T) <= 4, uint32_t, uint64_t>;
+  struct RadixEntry {
+    radix_key key;
+    NodeBase *node;
+  };
+  bool radix_sort();  // Stably sorts by key digits; false if it could not
+                      // get its scratch memory
+  static radix_key to_radix_key(
+      T value) noexcept;  // Key whose unsigned order is the order of value
+
   // attributes
+  node_allocator alloc_;
   size_type size_;
-  Node<value_type> *fake_node_;
+  NodeBase fake_node_;
 };
 
 // Member functions
 
-template <class value_type>
-List<value_type>::List() : size_(0) {
-  fake_node_ = new Node<value_type>;
-  if (!fake_node_) throw std::out_of_range("No memory allocated");
-  fake_node_->prev_ = fake_node_->next_ = fake_node_;
-}
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List() : List(Allocator()) {}
 
-template <class value_type>
-List<value_type>::List(size_type n) : List() {
-  for (size_type i = 0; i < n; ++i) {
-    push_back(value_type());
-  }
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(const Allocator &alloc)
+    : Stats("List"),
+      alloc_(alloc),
+      size_(0),
+      fake_node_(&fake_node_, &fake_node_) {}
+
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(size_type n) : List() {
+  Chain chain(*this);
+  for (size_type i = 0; i < n; ++i) chain.append();
+  chain.attach(&fake_node_);
 };
 
-template <class value_type>
-List<value_type>::List(std::initializer_list<value_type> const &items)
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(size_type n, const_reference value,
+                                         const Allocator &alloc)
+    : List(alloc) {
+  insert(cend(), n, value);
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class InputIt, class>
+List<value_type, Allocator, Stats>::List(InputIt first, InputIt last,
+                                         const Allocator &alloc)
+    : List(alloc) {
+  insert(cend(), first, last);
+}
+
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(
+    std::initializer_list<value_type> const &items)
     : List() {
-  for (auto item : items) {
-    push_back(item);
-  }
+  insert(cend(), items.begin(), items.end());
 }
 
-template <class value_type>
-List<value_type>::List(const List<value_type> &l) : List() {
-  for (auto it = l.cbegin(); it != l.cend(); ++it) {
-    push_back(it.it_->value_);
-  }
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(const List &l)
+    : List(Allocator(
+          node_traits::select_on_container_copy_construction(l.alloc_))) {
+  insert(cend(), l.cbegin(), l.cend());
 }
 
-template <class value_type>
-List<value_type>::List(List &&l) : size_(l.size_), fake_node_(l.fake_node_) {
-  l.size_ = 0;
-  l.fake_node_ = nullptr;
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::List(List &&l) : List(Allocator(l.alloc_)) {
+  take_nodes(l);
 }
 
-template <class value_type>
-List<value_type>::~List() {
+template <class value_type, class Allocator, class Stats>
+List<value_type, Allocator, Stats>::~List() {
   clear();
-  delete fake_node_;
 }
 
-template <class value_type>
-typename mynamespace::List<value_type>
-    &mynamespace::List<value_type>::operator=(List &&l) noexcept {
+template <class value_type, class Allocator, class Stats>
+typename mynamespace::List<value_type, Allocator, Stats>
+    &mynamespace::List<value_type, Allocator, Stats>::operator=(
+        List &&l) noexcept {
   swap(l);
   return *this;
 }
 
+// Existing nodes are reused for the first elements; only the difference in
+// length is allocated or freed.
+template <class value_type, class Allocator, class Stats>
+template <class InputIt, class>
+void List<value_type, Allocator, Stats>::assign(InputIt first, InputIt last) {
+  NodeBase *p = fake_node_.next_;
+  for (; p != &fake_node_ && first != last; p = p->next_, ++first) {
+    static_cast<Node<value_type> *>(p)->value_ = *first;
+  }
+  if (first != last) {
+    insert(cend(), first, last);
+  } else {
+    NodeBase *keep = p->prev_;
+    while (fake_node_.prev_ != keep) pop_back();
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::assign(size_type n,
+                                                const_reference value) {
+  NodeBase *p = fake_node_.next_;
+  for (; p != &fake_node_ && n > 0; p = p->next_, --n) {
+    static_cast<Node<value_type> *>(p)->value_ = value;
+  }
+  if (n > 0) {
+    insert(cend(), n, value);
+  } else {
+    NodeBase *keep = p->prev_;
+    while (fake_node_.prev_ != keep) pop_back();
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::allocator_type
+List<value_type, Allocator, Stats>::get_allocator() const {
+  return Allocator(alloc_);
+}
+
 // Element access
 
-template <class value_type>
-typename List<value_type>::const_reference List<value_type>::front() const {
-  return fake_node_->next_->value_;
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::const_reference
+List<value_type, Allocator, Stats>::front() const {
+  return *cbegin();
 }
 
-template <class value_type>
-typename List<value_type>::const_reference List<value_type>::back() const {
-  return fake_node_->prev_->value_;
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::const_reference
+List<value_type, Allocator, Stats>::back() const {
+  return *const_iterator(fake_node_.prev_);
 }
 
 // Iterators
 
-template <class value_type>
-typename List<value_type>::iterator List<value_type>::begin() noexcept {
-  return iterator(fake_node_->next_);
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::begin() noexcept {
+  return iterator(fake_node_.next_);
 }
 
-template <class value_type>
-typename List<value_type>::iterator List<value_type>::end() noexcept {
-  return iterator(fake_node_);
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::end() noexcept {
+  return iterator(&fake_node_);
 }
 
-template <class value_type>
-typename List<value_type>::const_iterator List<value_type>::cbegin()
-    const noexcept {
-  return const_iterator(fake_node_->next_);
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::const_iterator
+List<value_type, Allocator, Stats>::cbegin() const noexcept {
+  return const_iterator(fake_node_.next_);
 }
 
-template <class value_type>
-typename List<value_type>::const_iterator List<value_type>::cend()
-    const noexcept {
-  return const_iterator(fake_node_);
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::const_iterator
+List<value_type, Allocator, Stats>::cend() const noexcept {
+  return const_iterator(const_cast<NodeBase *>(&fake_node_));
 }
 
 // Capacity
 
-template <class value_type>
-bool List<value_type>::empty() const noexcept {
+template <class value_type, class Allocator, class Stats>
+bool List<value_type, Allocator, Stats>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <class value_type>
-typename List<value_type>::size_type List<value_type>::size() const noexcept {
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::size_type
+List<value_type, Allocator, Stats>::size() const noexcept {
   return size_;
 }
 
-template <class value_type>
-typename List<value_type>::size_type List<value_type>::max_size()
-    const noexcept {
-  return (std::numeric_limits<size_type>::max() / sizeof(Node<value_type>) - 1);
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::size_type
+List<value_type, Allocator, Stats>::max_size() const noexcept {
+  return node_traits::max_size(alloc_);
 }
 
 // Modifiers
 
-template <class value_type>
-void List<value_type>::clear() noexcept {
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::clear() noexcept {
+  Stats::on_call(StatsOp::kClear);
   while (size_ > 0) pop_back();
 }
 
-template <class value_type>
-typename List<value_type>::iterator List<value_type>::insert(
-    iterator pos, const_reference value) {
-  Node<value_type> *p = new Node<value_type>(value, pos.it_->prev_, pos.it_);
-  if (!p) throw std::out_of_range("No memory allocated");
-  pos.it_->prev_->next_ = p;
-  pos.it_->prev_ = p;
-  ++size_;
-  --pos;
-  return pos;
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::insert(iterator pos,
+                                           const_reference value) {
+  Node<value_type> *p = create_node(value);
+  link_before(pos.it_, p);
+  return iterator(p);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::insert(iterator pos, value_type &&value) {
+  Node<value_type> *p = create_node(std::move(value));
+  link_before(pos.it_, p);
+  return iterator(p);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::insert(const_iterator pos, size_type n,
+                                           const_reference value) {
+  Chain chain(*this);
+  for (size_type i = 0; i < n; ++i) chain.append(value);
+  return chain.attach(pos.it_);
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class InputIt, class>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::insert(const_iterator pos, InputIt first,
+                                           InputIt last) {
+  Chain chain(*this);
+  for (; first != last; ++first) chain.append(*first);
+  return chain.attach(pos.it_);
 }
 
-template <class value_type>
-void List<value_type>::erase(iterator pos) {
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::emplace(const_iterator pos,
+                                            Args &&...args) {
+  Node<value_type> *p = create_node(std::forward<Args>(args)...);
+  link_before(pos.it_, p);
+  return iterator(p);
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::erase(iterator pos) {
   if (size_ > 0) {
-    pos.it_->prev_->next_ = pos.it_->next_;
-    pos.it_->next_->prev_ = pos.it_->prev_;
-    delete pos.it_;
-    --size_;
+    destroy_node(unlink(pos.it_));
   }
 }
 
-template <class value_type>
-void List<value_type>::push_back(const_reference value) {
-  Node<value_type> *p = new Node<value_type>(value);
-  if (!p) throw std::out_of_range("No memory allocated");
-  p->prev_ = fake_node_->prev_;
-  p->next_ = fake_node_;
-  fake_node_->prev_->next_ = p;
-  fake_node_->prev_ = p;
-  ++size_;
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::push_back(const_reference value) {
+  link_before(&fake_node_, create_node(value));
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::push_back(value_type &&value) {
+  link_before(&fake_node_, create_node(std::move(value)));
 }
 
-template <class value_type>
-void List<value_type>::pop_back() {
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename List<value_type, Allocator, Stats>::reference
+List<value_type, Allocator, Stats>::emplace_back(Args &&...args) {
+  Node<value_type> *p = create_node(std::forward<Args>(args)...);
+  link_before(&fake_node_, p);
+  return p->value_;
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::pop_back() {
   if (size_ > 0) {
-    Node<value_type> *p = fake_node_->prev_;
-    fake_node_->prev_ = fake_node_->prev_->prev_;
-    fake_node_->prev_->next_ = fake_node_;
-    delete p;
-    --size_;
+    destroy_node(unlink(fake_node_.prev_));
   }
 }
 
-template <class value_type>
-void List<value_type>::push_front(const_reference value) {
-  Node<value_type> *p = new Node<value_type>(value);
-  if (!p) throw std::out_of_range("No memory allocated");
-  p->prev_ = fake_node_;
-  p->next_ = fake_node_->next_;
-  fake_node_->next_->prev_ = p;
-  fake_node_->next_ = p;
-  ++size_;
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::push_front(const_reference value) {
+  link_before(fake_node_.next_, create_node(value));
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::push_front(value_type &&value) {
+  link_before(fake_node_.next_, create_node(std::move(value)));
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename List<value_type, Allocator, Stats>::reference
+List<value_type, Allocator, Stats>::emplace_front(Args &&...args) {
+  Node<value_type> *p = create_node(std::forward<Args>(args)...);
+  link_before(fake_node_.next_, p);
+  return p->value_;
 }
 
-template <class value_type>
-void List<value_type>::pop_front() {
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::pop_front() {
   if (size_ > 0) {
-    Node<value_type> *p = fake_node_->next_;
-    fake_node_->next_ = fake_node_->next_->next_;
-    fake_node_->next_->prev_ = fake_node_;
-    delete p;
-    --size_;
+    destroy_node(unlink(fake_node_.next_));
   }
 }
 
-template <class value_type>
-void List<value_type>::swap(List &other) noexcept {
-  std::swap(size_, other.size_);
-  std::swap(fake_node_, other.fake_node_);
+// The sentinels trade links, then the boundary nodes are pointed at their
+// new sentinel; an empty list's sentinel points at itself again. No list is
+// constructed, so nothing here can throw or register with StatsRegistry.
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::swap(List &other) noexcept {
+  if (this == &other) return;
+  std::swap(fake_node_.next_, other.fake_node_.next_);
+  std::swap(fake_node_.prev_, other.fake_node_.prev_);
+  size_type mine = size_;
+  size_type theirs = other.size_;
+  size_ = theirs;
+  other.size_ = mine;
+  for (List *l : {this, &other}) {
+    NodeBase &fake = l->fake_node_;
+    if (l->size_ == 0) {
+      fake.next_ = fake.prev_ = &fake;
+    } else {
+      fake.next_->prev_ = &fake;
+      fake.prev_->next_ = &fake;
+    }
+  }
+  Stats::on_transfer(other, theirs * sizeof(Node<value_type>));
+  other.Stats::on_transfer(*this, mine * sizeof(Node<value_type>));
+  Stats::on_size(size_);
+  other.Stats::on_size(other.size_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template <class value_type>
-void List<value_type>::merge(List &other) {
-  if (this != &other) {
-    for (iterator it = other.begin(); it != other.end();) {
-      ++it;
-      push_back(other.front());
-      other.pop_front();
-    }
-    sort();
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::merge(List &other) {
+  merge(other, std::less<value_type>());
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class Compare>
+void List<value_type, Allocator, Stats>::merge(List &other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  if (!same_allocator(other)) {
+    List temp(get_allocator());
+    temp.splice(temp.cend(), other);
+    merge(temp, comp);
+    return;
   }
+  Stats::on_call(StatsOp::kMerge);
+  fake_node_.prev_->next_ = nullptr;
+  other.fake_node_.prev_->next_ = nullptr;
+  NodeBase *first = size_ > 0 ? fake_node_.next_ : nullptr;
+  relink(merge_chains(first, other.fake_node_.next_, comp));
+  adopt(other, other.size_);
+  other.fake_node_.next_ = other.fake_node_.prev_ = &other.fake_node_;
 }
 
-template <class value_type>
-void List<value_type>::splice(const_iterator pos, List &other) {
-  if (this != &other) {
-    for (iterator it = other.begin(); it != other.end();) {
-      ++it;
-      insert(pos, other.front());
-      other.pop_front();
-    }
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::splice(const_iterator pos,
+                                                List &other) {
+  Stats::on_call(StatsOp::kSplice);
+  if (this == &other || other.empty()) return;
+  if (same_allocator(other)) {
+    transfer(pos.it_, other.fake_node_.next_, &other.fake_node_);
+    adopt(other, other.size_);
+  } else {
+    copy_transfer(pos.it_, other, other.fake_node_.next_, &other.fake_node_);
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::splice(const_iterator pos,
+                                                List &other,
+                                                const_iterator it) {
+  Stats::on_call(StatsOp::kSplice);
+  if (pos.it_ == it.it_ || pos.it_ == it.it_->next_) return;
+  if (same_allocator(other)) {
+    transfer(pos.it_, it.it_, it.it_->next_);
+    adopt(other, 1);
+  } else {
+    copy_transfer(pos.it_, other, it.it_, it.it_->next_);
   }
 }
 
-template <class value_type>
-void List<value_type>::reverse() noexcept {
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::splice(const_iterator pos,
+                                                List &other,
+                                                const_iterator first,
+                                                const_iterator last) {
+  Stats::on_call(StatsOp::kSplice);
+  if (first == last) return;
+  if (this == &other) {
+    transfer(pos.it_, first.it_, last.it_);
+  } else if (same_allocator(other)) {
+    size_type n = 0;
+    for (NodeBase *p = first.it_; p != last.it_; p = p->next_) ++n;
+    transfer(pos.it_, first.it_, last.it_);
+    adopt(other, n);
+  } else {
+    copy_transfer(pos.it_, other, first.it_, last.it_);
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::reverse() noexcept {
+  Stats::on_call(StatsOp::kReverse);
   size_type mid = 0;
   iterator it1 = begin();
   iterator it2 = --end();
   for (; mid < size_ / 2; ++it1, --it2, ++mid) {
-    std::swap(it1.it_->value_, it2.it_->value_);
+    std::swap(static_cast<Node<value_type> *>(it1.it_)->value_,
+              static_cast<Node<value_type> *>(it2.it_)->value_);
   }
 }
 
-template <class value_type>
-void List<value_type>::unique() {
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::unique() {
+  Stats::on_call(StatsOp::kUnique);
   for (iterator it = begin(); it != end(); ++it) {
     iterator temp = it;
     ++temp;
-    if (*it == *temp && temp.it_ != fake_node_) {
+    if (temp.it_ != &fake_node_ && *it == *temp) {
       erase(temp);
       --it;
     }
   }
 }
 
-template <class value_type>
-void List<value_type>::sort() {
-  for (iterator it1 = begin(); it1 != end(); ++it1) {
-    for (iterator it2 = it1; it2 != end(); ++it2) {
-      if (*it2 < *it1) std::swap(it1.it_->value_, it2.it_->value_);
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::sort() {
+  if constexpr (kRadixSortable) {
+    if (size_ >= kRadixMinSize && radix_sort()) return;
+  }
+  sort(std::less<value_type>());
+}
+
+// Bottom-up merge sort: bins[i] holds a sorted run of 2^i nodes. Nodes are
+// only relinked through next_, prev_ is rebuilt at the end.
+template <class value_type, class Allocator, class Stats>
+template <class Compare>
+void List<value_type, Allocator, Stats>::sort(Compare comp) {
+  Stats::on_call(StatsOp::kSort);
+  if (size_ < 2) return;
+  NodeBase *bins[std::numeric_limits<size_type>::digits] = {};
+  size_type filled = 0;
+  fake_node_.prev_->next_ = nullptr;
+  for (NodeBase *p = fake_node_.next_; p;) {
+    NodeBase *carry = p;
+    p = p->next_;
+    carry->next_ = nullptr;
+    size_type i = 0;
+    for (; i < filled && bins[i]; ++i) {
+      carry = merge_chains(bins[i], carry, comp);
+      bins[i] = nullptr;
     }
+    bins[i] = carry;
+    if (i == filled) ++filled;
+  }
+  NodeBase *result = nullptr;
+  for (size_type i = 0; i < filled; ++i) {
+    if (bins[i]) result = merge_chains(bins[i], result, comp);
   }
+  relink(result);
 }
 
-template <class value_type>
+template <class value_type, class Allocator, class Stats>
 template <class... Args>
-typename List<value_type>::iterator List<value_type>::insert_many(
-    const_iterator pos, Args &&...args) {
-  for (auto it : {args...}) {
-    insert(pos, it);
-  }
+typename List<value_type, Allocator, Stats>::iterator
+List<value_type, Allocator, Stats>::insert_many(const_iterator pos,
+                                                Args &&...args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
   return pos;
 }
 
-template <class value_type>
+template <class value_type, class Allocator, class Stats>
 template <class... Args>
-void List<value_type>::insert_many_back(Args &&...args) {
+void List<value_type, Allocator, Stats>::insert_many_back(Args &&...args) {
   auto pos = cend();
-  insert_many(pos, args...);
+  insert_many(pos, std::forward<Args>(args)...);
 }
 
-template <class value_type>
+template <class value_type, class Allocator, class Stats>
 template <class... Args>
-void List<value_type>::insert_many_front(Args &&...args) {
+void List<value_type, Allocator, Stats>::insert_many_front(Args &&...args) {
   auto pos = cbegin();
-  insert_many(pos, args...);
+  insert_many(pos, std::forward<Args>(args)...);
+}
+
+// Serialization
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::save(const std::string &path) const {
+  archive::write<value_type>(path, cbegin(), size_);
+}
+
+// The nodes are built off the list and linked in once the whole archive
+// has been read and checked, so a failed load leaves the list as it was.
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::load(const std::string &path) {
+  archive::Reader<value_type> reader(path);
+  Chain chain(*this);
+  reader.for_each(
+      [&chain](value_type &&value) { chain.append(std::move(value)); });
+  clear();
+  chain.attach(&fake_node_);
+}
+
+// Instrumentation
+
+template <class value_type, class Allocator, class Stats>
+ContainerStats List<value_type, Allocator, Stats>::stats() const noexcept {
+  return Stats::snapshot();
+}
+
+// Node management
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename List<value_type, Allocator, Stats>::template Node<value_type>
+    *List<value_type, Allocator, Stats>::create_node(Args &&...args) {
+  Node<value_type> *p = node_traits::allocate(alloc_, 1);
+  Stats::on_allocate(sizeof(Node<value_type>));
+  try {
+    node_traits::construct(alloc_, p, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, p, 1);
+    Stats::on_deallocate(sizeof(Node<value_type>));
+    throw;
+  }
+  return p;
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::destroy_node(NodeBase *p) noexcept {
+  Node<value_type> *node = static_cast<Node<value_type> *>(p);
+  node_traits::destroy(alloc_, node);
+  node_traits::deallocate(alloc_, node, 1);
+  Stats::on_deallocate(sizeof(Node<value_type>));
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::link_before(NodeBase *pos,
+                                                     NodeBase *p) noexcept {
+  p->prev_ = pos->prev_;
+  p->next_ = pos;
+  pos->prev_->next_ = p;
+  pos->prev_ = p;
+  ++size_;
+  Stats::on_call(StatsOp::kInsert);
+  Stats::on_size(size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::NodeBase *
+List<value_type, Allocator, Stats>::unlink(NodeBase *p) noexcept {
+  p->prev_->next_ = p->next_;
+  p->next_->prev_ = p->prev_;
+  --size_;
+  Stats::on_call(StatsOp::kErase);
+  return p;
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::take_nodes(List &other) noexcept {
+  if (other.size_ > 0) {
+    fake_node_.next_ = other.fake_node_.next_;
+    fake_node_.prev_ = other.fake_node_.prev_;
+    fake_node_.next_->prev_ = &fake_node_;
+    fake_node_.prev_->next_ = &fake_node_;
+    adopt(other, other.size_);
+    other.fake_node_.next_ = other.fake_node_.prev_ = &other.fake_node_;
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::adopt(List &other,
+                                               size_type n) noexcept {
+  size_ += n;
+  other.size_ -= n;
+  Stats::on_transfer(other, n * sizeof(Node<value_type>));
+  Stats::on_size(size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+bool List<value_type, Allocator, Stats>::same_allocator(
+    const List &other) const noexcept {
+  if constexpr (node_traits::is_always_equal::value) {
+    return true;
+  } else {
+    return alloc_ == other.alloc_;
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::transfer(NodeBase *pos,
+                                                  NodeBase *first,
+                                                  NodeBase *last) noexcept {
+  if (first == last || pos == first || pos == last) return;
+  NodeBase *before = first->prev_;
+  NodeBase *tail = last->prev_;
+  before->next_ = last;
+  last->prev_ = before;
+  first->prev_ = pos->prev_;
+  tail->next_ = pos;
+  pos->prev_->next_ = first;
+  pos->prev_ = tail;
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::copy_transfer(NodeBase *pos,
+                                                       List &other,
+                                                       NodeBase *first,
+                                                       NodeBase *last) {
+  while (first != last) {
+    NodeBase *next = first->next_;
+    link_before(pos, create_node(std::move(
+                         static_cast<Node<value_type> *>(first)->value_)));
+    other.destroy_node(other.unlink(first));
+    first = next;
+  }
+}
+
+template <class value_type, class Allocator, class Stats>
+void List<value_type, Allocator, Stats>::relink(NodeBase *first) noexcept {
+  NodeBase *prev = &fake_node_;
+  for (NodeBase *p = first; p; p = p->next_) {
+    prev->next_ = p;
+    p->prev_ = prev;
+    prev = p;
+  }
+  prev->next_ = &fake_node_;
+  fake_node_.prev_ = prev;
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class Compare>
+typename List<value_type, Allocator, Stats>::NodeBase *
+List<value_type, Allocator, Stats>::merge_chains(NodeBase *a, NodeBase *b,
+                                                 Compare &comp) {
+  NodeBase head;
+  NodeBase *tail = &head;
+  while (a && b) {
+    if (comp(value_of(b), value_of(a))) {
+      tail->next_ = b;
+      b = b->next_;
+    } else {
+      tail->next_ = a;
+      a = a->next_;
+    }
+    tail = tail->next_;
+  }
+  tail->next_ = a ? a : b;
+  return head.next_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::const_reference
+List<value_type, Allocator, Stats>::value_of(const NodeBase *p) noexcept {
+  return static_cast<const Node<value_type> *>(p)->value_;
+}
+
+// LSD radix sort of (key, node) pairs copied out of the list, so the passes
+// stream through two contiguous arrays instead of chasing nodes. One walk
+// over the list fills the array and counts the digits of every pass; a pass
+// in which all keys share the digit is skipped. Each pass is a stable
+// scatter, so equal elements keep their order as with the merge sort.
+template <class value_type, class Allocator, class Stats>
+bool List<value_type, Allocator, Stats>::radix_sort() {
+  constexpr size_type kBuckets = size_type{1} << kRadixBits;
+  constexpr unsigned kPasses =
+      (sizeof(value_type) * 8 + kRadixBits - 1) / kRadixBits;
+  using entry_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<RadixEntry>;
+  using entry_traits = std::allocator_traits<entry_allocator>;
+  entry_allocator alloc(alloc_);
+  RadixEntry *entries;
+  try {
+    entries = entry_traits::allocate(alloc, 2 * size_);
+  } catch (const std::bad_alloc &) {
+    return false;
+  }
+  Stats::on_call(StatsOp::kSort);
+  size_type counts[kPasses][kBuckets] = {};
+  RadixEntry *src = entries;
+  RadixEntry *dst = entries + size_;
+  size_type n = 0;
+  for (NodeBase *p = fake_node_.next_; p != &fake_node_; p = p->next_, ++n) {
+    radix_key key = to_radix_key(value_of(p));
+    src[n] = {key, p};
+    for (unsigned pass = 0; pass < kPasses; ++pass) {
+      ++counts[pass][(key >> (pass * kRadixBits)) & (kBuckets - 1)];
+    }
+  }
+  for (unsigned pass = 0; pass < kPasses; ++pass) {
+    unsigned shift = pass * kRadixBits;
+    size_type *count = counts[pass];
+    if (count[(src[0].key >> shift) & (kBuckets - 1)] == size_) continue;
+    size_type offset = 0;
+    for (size_type b = 0; b < kBuckets; ++b) {
+      size_type c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    for (size_type i = 0; i < size_; ++i) {
+      dst[count[(src[i].key >> shift) & (kBuckets - 1)]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  // The nodes are visited in sorted order, which is scattered in memory;
+  // prefetching a few ahead overlaps their cache misses.
+  NodeBase *prev = &fake_node_;
+  for (size_type i = 0; i < size_; ++i) {
+    if (i + 8 < size_) __builtin_prefetch(src[i + 8].node, 1);
+    prev->next_ = src[i].node;
+    src[i].node->prev_ = prev;
+    prev = src[i].node;
+  }
+  prev->next_ = &fake_node_;
+  fake_node_.prev_ = prev;
+  entry_traits::deallocate(alloc, entries, 2 * size_);
+  return true;
+}
+
+// Signed integers have their sign bit flipped. Floating-point numbers are
+// compared by their bits: negative ones have all bits flipped, so a larger
+// magnitude sorts first, and the rest have the sign bit set. Negative zero
+// is taken as zero, since the two compare equal.
+template <class value_type, class Allocator, class Stats>
+typename List<value_type, Allocator, Stats>::radix_key
+List<value_type, Allocator, Stats>::to_radix_key(value_type value) noexcept {
+  constexpr radix_key kSign = radix_key{1} << (sizeof(value_type) * 8 - 1);
+  if constexpr (std::is_floating_point<value_type>::value) {
+    if (value == 0) value = 0;
+    radix_key bits;
+    std::memcpy(&bits, &value, sizeof(value));
+    return bits & kSign ? ~bits : bits | kSign;
+  } else if constexpr (std::is_signed<value_type>::value) {
+    return static_cast<radix_key>(
+               static_cast<std::make_unsigned_t<value_type>>(value)) ^
+           kSign;
+  } else {
+    return static_cast<radix_key>(value);
+  }
 }
 
 }  // namespace mynamespace
@@ -0,0 +1,179 @@
+#ifndef SRC_MY_MAP_H_
+#define SRC_MY_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "my_btree.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Sorted map from unique keys to values on a B-tree. Elements are
+// std::pair<const Key, T> as in std::map; moving one between nodes copies
+// its key, so cheaply copied keys suit it best.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class Map : private BTree<Key, std::pair<const Key, T>, Compare, Allocator,
+                          false> {
+  using tree = BTree<Key, std::pair<const Key, T>, Compare, Allocator, false>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Member types
+  using key_type = Key;    // The type of a key
+  using mapped_type = T;   // The type of a value
+  using value_type =
+      std::pair<const key_type, mapped_type>;  // The type of an element
+  using reference =
+      value_type &;  // The type of the reference to an element
+  using const_reference =
+      const value_type &;  // The type of the constant reference to an element
+  using iterator =
+      typename tree::iterator;  // The type for iterating through the
+                                // container, in key order
+  using const_iterator =
+      typename tree::const_iterator;  // The constant type for iterating
+                                      // through the container
+  using size_type = size_t;           // The type of the container size
+  using key_compare = Compare;        // The type of the key ordering
+  using allocator_type = Allocator;   // The type of the element allocator
+
+  // Member functions
+  Map() {}  // Default constructor
+
+  Map(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }  // Initializer list constructor
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  Map(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }  // Range constructor
+
+  Map(const Map &m) : tree(m) {}  // Copy constructor
+
+  Map(Map &&m) noexcept : tree(std::move(m)) {}  // Move constructor
+
+  ~Map() {}  // Destructor
+
+  Map &operator=(Map &&m) noexcept {
+    tree::operator=(std::move(m));
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  using tree::get_allocator;
+  using tree::key_comp;
+
+  // Element access
+
+  T &at(const Key &key) {
+    iterator it = tree::find(key);
+    if (it == tree::end()) throw std::out_of_range("Key not found");
+    return it->second;
+  }  // Access specified element with bounds check
+
+  const T &at(const Key &key) const {
+    const_iterator it = tree::find(key);
+    if (it == tree::end()) throw std::out_of_range("Key not found");
+    return it->second;
+  }
+
+  T &operator[](const Key &key) {
+    return tree::emplace_key(key, std::piecewise_construct,
+                             std::forward_as_tuple(key), std::tuple<>())
+        .first->second;
+  }  // Access or insert specified element
+
+  // Iterators
+
+  using tree::begin;
+  using tree::cbegin;
+  using tree::cend;
+  using tree::end;
+
+  // Capacity
+
+  using tree::empty;
+  using tree::max_size;
+  using tree::size;
+
+  // Modifiers
+
+  using tree::clear;
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree::emplace_key(value.first, value);
+  }  // Inserts value unless its key is present; invalidates iterators
+
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return tree::emplace_key(key, key, obj);
+  }  // Inserts the pair unless key is present
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> result = tree::emplace_key(key, key, obj);
+    if (!result.second) result.first->second = obj;
+    return result;
+  }  // Inserts the pair or assigns obj to the present key
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree::emplace_value(std::forward<Args>(args)...);
+  }  // Constructs the pair in-place and inserts it if the key is new
+
+  iterator erase(const_iterator pos) {
+    return tree::erase(pos);
+  }  // Erases element at pos and returns the iterator to the next one
+
+  iterator erase(iterator pos) { return tree::erase(pos); }
+
+  size_type erase(const key_type &key) {
+    return tree::erase(key);
+  }  // Erases key and returns the number of erased elements
+
+  void swap(Map &other) noexcept { tree::swap(other); }  // Swaps the contents
+
+  void merge(Map &other) {
+    tree::merge_from(other);
+  }  // Moves over the elements of other whose keys are not yet present
+
+  // Lookup
+
+  using tree::contains;
+  using tree::count;
+  using tree::equal_range;
+  using tree::find;
+  using tree::lower_bound;
+  using tree::upper_bound;
+
+  // Bonus
+
+  template <class... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    Vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (const value_type &item : items) {
+      result.push_back({iterator(), insert(item).second});
+    }
+    for (size_type i = 0; i < sizeof...(Args); ++i) {
+      result[i].first = find(items[i].first);
+    }
+    return result;
+  }  // Inserts new elements; each result points at the element with that
+     // key once all are in, as every insert invalidates iterators
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_MAP_H_
@@ -0,0 +1,221 @@
+#ifndef SRC_MY_MPMC_QUEUE_H_
+#define SRC_MY_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "my_cache_line.h"
+
+namespace mynamespace {
+
+// Bounded lock-free queue for any number of producer and consumer threads,
+// after Dmitry Vyukov's design. Every slot carries a sequence number that
+// says whose turn it is: a slot at position pos is free for the producer
+// that claims pos when its sequence equals 2 pos, and ready for the consumer
+// that claims pos when it equals 2 pos + 1. Producers and consumers claim
+// positions with a CAS on their own counter and hand the slot over with a
+// release store of the next sequence number, so the only contended lines are
+// the two counters. There is one slot per element of capacity, so the bound
+// is exact; a power-of-two capacity maps positions to slots with a mask
+// instead of a division. Doubling the sequence keeps "ready for pos" apart
+// from "free for pos + 1" even when a single slot serves both.
+//
+// size and empty are exact only when the queue is quiescent.
+template <class T>
+class MpmcQueue {
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+
+  // Member functions
+  explicit MpmcQueue(size_type capacity);  // Parameterized constructor
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+  ~MpmcQueue();  // Destructor
+
+  // Capacity
+  bool empty() const noexcept;          // Checks whether the queue is empty
+  size_type size() const noexcept;      // Returns the number of elements
+  size_type capacity() const noexcept;  // Returns the maximum number of
+                                        // elements
+
+  // Modifiers
+  bool try_push(const_reference value);  // Inserts element unless full
+  bool try_push(value_type &&value);     // Moves element unless full
+  template <class... Args>
+  bool try_emplace(Args &&...args);  // Constructs element unless full
+  bool try_pop(value_type &value);   // Moves out the first element unless
+                                     // empty
+
+ private:
+  struct Slot {
+    std::atomic<size_type> sequence_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+
+    value_type *value() noexcept {
+      return reinterpret_cast<value_type *>(storage_);
+    }
+  };
+
+  template <class... Args>
+  bool claim_and_construct(Args &&...args);  // Core of try_emplace
+  Slot &slot_at(size_type pos) const noexcept;  // The slot of a position
+
+  // attributes
+  size_type capacity_;
+  size_type slot_count_;
+  size_type mask_;  // slot_count_ - 1 if that is a power of two, else 0
+  std::unique_ptr<Slot[]> slots_;
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_;
+};
+
+// A queue of capacity 0 gets a single slot whose sequence never comes round,
+// so it reads as both full and empty forever.
+template <class value_type>
+MpmcQueue<value_type>::MpmcQueue(size_type capacity)
+    : capacity_(capacity),
+      slot_count_(capacity > 0 ? capacity : 1),
+      mask_((slot_count_ & (slot_count_ - 1)) == 0 ? slot_count_ - 1 : 0),
+      slots_(new Slot[slot_count_]),
+      enqueue_pos_(0),
+      dequeue_pos_(0) {
+  for (size_type i = 0; i < slot_count_; ++i) {
+    slots_[i].sequence_.store(2 * i, std::memory_order_relaxed);
+  }
+  if (capacity_ == 0) {
+    slots_[0].sequence_.store(static_cast<size_type>(-1),
+                              std::memory_order_relaxed);
+  }
+}
+
+template <class value_type>
+MpmcQueue<value_type>::~MpmcQueue() {
+  size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != tail; ++pos) {
+    slot_at(pos).value()->~value_type();
+  }
+}
+
+// Capacity
+
+template <class value_type>
+bool MpmcQueue<value_type>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class value_type>
+typename MpmcQueue<value_type>::size_type MpmcQueue<value_type>::size()
+    const noexcept {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  if (static_cast<std::ptrdiff_t>(tail - head) < 0) return 0;
+  return tail - head > capacity() ? capacity() : tail - head;
+}
+
+template <class value_type>
+typename MpmcQueue<value_type>::size_type MpmcQueue<value_type>::capacity()
+    const noexcept {
+  return capacity_;
+}
+
+// Modifiers
+
+template <class value_type>
+bool MpmcQueue<value_type>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <class value_type>
+bool MpmcQueue<value_type>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <class value_type>
+template <class... Args>
+bool MpmcQueue<value_type>::try_emplace(Args &&...args) {
+  // A claimed slot cannot be given back, so a constructor that may throw
+  // runs before the claim and the slot receives a non-throwing move.
+  if constexpr (std::is_nothrow_constructible_v<value_type, Args &&...>) {
+    return claim_and_construct(std::forward<Args>(args)...);
+  } else {
+    static_assert(std::is_nothrow_move_constructible_v<value_type>,
+                  "MpmcQueue needs a non-throwing move constructor");
+    value_type value(std::forward<Args>(args)...);
+    return claim_and_construct(std::move(value));
+  }
+}
+
+template <class value_type>
+bool MpmcQueue<value_type>::try_pop(value_type &value) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Slot *slot;
+  for (;;) {
+    slot = &slot_at(pos);
+    size_type sequence = slot->sequence_.load(std::memory_order_acquire);
+    std::ptrdiff_t diff =
+        static_cast<std::ptrdiff_t>(sequence - (2 * pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  value = std::move(*slot->value());
+  slot->value()->~value_type();
+  slot->sequence_.store(2 * (pos + slot_count_), std::memory_order_release);
+  return true;
+}
+
+// Positions wrap around the slots by division unless the slot count is a
+// power of two; a size_t position counter does not overflow in practice.
+template <class value_type>
+typename MpmcQueue<value_type>::Slot &MpmcQueue<value_type>::slot_at(
+    size_type pos) const noexcept {
+  return slots_[mask_ != 0 ? pos & mask_ : pos % slot_count_];
+}
+
+template <class value_type>
+template <class... Args>
+bool MpmcQueue<value_type>::claim_and_construct(Args &&...args) {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot *slot;
+  for (;;) {
+    slot = &slot_at(pos);
+    size_type sequence = slot->sequence_.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - 2 * pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  ::new (static_cast<void *>(slot->value()))
+      value_type(std::forward<Args>(args)...);
+  slot->sequence_.store(2 * pos + 1, std::memory_order_release);
+  return true;
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_MPMC_QUEUE_H_
@@ -0,0 +1,170 @@
+#ifndef SRC_MY_MULTISET_H_
+#define SRC_MY_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "my_btree.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Sorted multiset on a B-tree. Equal keys are kept in insertion order.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class Multiset : private BTree<Key, Key, Compare, Allocator, true> {
+  using tree = BTree<Key, Key, Compare, Allocator, true>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Member types
+  using key_type = Key;    // The type of a key
+  using value_type = Key;  // The type of an element
+  using reference =
+      value_type &;  // The type of the reference to an element
+  using const_reference =
+      const value_type &;  // The type of the constant reference to an element
+  using iterator =
+      typename tree::const_iterator;  // The type for iterating through the
+                                      // container, in key order
+  using const_iterator =
+      typename tree::const_iterator;  // The constant type for iterating
+                                      // through the container
+  using size_type = size_t;           // The type of the container size
+  using key_compare = Compare;        // The type of the key ordering
+  using allocator_type = Allocator;   // The type of the element allocator
+
+  // Member functions
+  Multiset() {}  // Default constructor
+
+  Multiset(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }  // Initializer list constructor
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  Multiset(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }  // Range constructor
+
+  Multiset(const Multiset &ms) : tree(ms) {}  // Copy constructor
+
+  Multiset(Multiset &&ms) noexcept
+      : tree(std::move(ms)) {}  // Move constructor
+
+  ~Multiset() {}  // Destructor
+
+  Multiset &operator=(Multiset &&ms) noexcept {
+    tree::operator=(std::move(ms));
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  using tree::get_allocator;
+  using tree::key_comp;
+
+  // Iterators
+
+  iterator begin() const noexcept {
+    return tree::cbegin();
+  }  // Returns an iterator to the smallest key
+
+  iterator end() const noexcept {
+    return tree::cend();
+  }  // Returns an iterator past the greatest key
+
+  using tree::cbegin;
+  using tree::cend;
+
+  // Capacity
+
+  using tree::empty;
+  using tree::max_size;
+  using tree::size;
+
+  // Modifiers
+
+  using tree::clear;
+
+  iterator insert(const value_type &value) {
+    return tree::emplace_key(value, value).first;
+  }  // Inserts value after any equal keys; invalidates iterators
+
+  iterator insert(value_type &&value) {
+    return tree::emplace_key(value, std::move(value)).first;
+  }  // Moves value in after any equal keys
+
+  template <class... Args>
+  iterator emplace(Args &&...args) {
+    return tree::emplace_value(std::forward<Args>(args)...).first;
+  }  // Constructs the key in-place and inserts it
+
+  iterator erase(iterator pos) {
+    return tree::erase(pos);
+  }  // Erases element at pos and returns the iterator to the next one
+
+  size_type erase(const key_type &key) {
+    return tree::erase(key);
+  }  // Erases every copy of key and returns how many there were
+
+  void swap(Multiset &other) noexcept {
+    tree::swap(other);
+  }  // Swaps the contents
+
+  void merge(Multiset &other) {
+    tree::merge_from(other);
+  }  // Moves over all elements of other
+
+  // Lookup
+
+  iterator find(const key_type &key) const {
+    return tree::find(key);
+  }  // Finds the first copy of key
+
+  using tree::contains;
+  using tree::count;
+
+  iterator lower_bound(const key_type &key) const {
+    return tree::lower_bound(key);
+  }  // Returns the first key not less than key
+
+  iterator upper_bound(const key_type &key) const {
+    return tree::upper_bound(key);
+  }  // Returns the first key greater than key
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return tree::equal_range(key);
+  }  // Returns the range of keys equal to key
+
+  // Bonus
+
+  template <class... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    for (const value_type &item : items) insert(item);
+    Vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (size_type i = 0; i < sizeof...(Args); ++i) {
+      iterator it = upper_bound(items[i]);
+      for (size_type j = i; j < sizeof...(Args); ++j) {
+        if (!key_comp()(items[i], items[j]) &&
+            !key_comp()(items[j], items[i])) {
+          --it;
+        }
+      }
+      result.push_back({it, true});
+    }
+    return result;
+  }  // Inserts new elements. Each went in after its equal keys, so the
+     // copies made here are the last of their range, in argument order
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_MULTISET_H_
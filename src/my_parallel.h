@@ -0,0 +1,253 @@
+#ifndef SRC_MY_PARALLEL_H_
+#define SRC_MY_PARALLEL_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "my_list.h"
+#include "my_thread_pool.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Algorithms that split a container into one segment per thread of a
+// ThreadPool, ThreadPool::shared() unless another is passed, and process
+// the segments concurrently, the calling thread included. A single walk
+// over the container finds the segment boundaries, so they suit node-based
+// containers such as List as well as Vector and Deque. Queue and Stack are
+// processed through their containers.
+//
+// grain is the fewest elements a segment gets: a container holding fewer
+// than two grains is processed by the calling thread alone, as the hand-off
+// would cost more than it saves. Functions passed in are called
+// concurrently from several threads. If one throws, the other segments
+// still run and the first exception is rethrown once all have finished.
+namespace parallel {
+
+constexpr size_t kDefaultGrain = 4096;  // Default fewest elements per task
+
+namespace internal {
+
+template <class C>
+auto contents(C &c, int) -> decltype(c.container()) {
+  return c.container();
+}  // The container of an adapter
+
+template <class C>
+C &contents(C &c, long) {
+  return c;
+}  // Any other container itself
+
+// Cuts the n elements of [first, last) into up to parts segments of nearly
+// equal length, returning the parts + 1 boundaries. The last segment is not
+// walked.
+template <class Iterator>
+Vector<Iterator> split(Iterator first, Iterator last, size_t n, size_t grain,
+                       size_t parts) {
+  parts = std::max<size_t>(1, std::min(parts, n / std::max<size_t>(grain, 1)));
+  Vector<Iterator> cuts;
+  cuts.reserve(parts + 1);
+  cuts.push_back(first);
+  for (size_t i = 0; i + 1 < parts; ++i) {
+    first = std::next(first, static_cast<std::ptrdiff_t>(n / parts +
+                                                         (i < n % parts)));
+    cuts.push_back(first);
+  }
+  cuts.push_back(last);
+  return cuts;
+}
+
+// Runs body(0) .. body(parts - 1), all but the first on the pool. While
+// its tasks are outstanding the caller runs queued tasks too, so nested
+// parallel calls from pool threads cannot wait on each other forever.
+template <class Body>
+void run(ThreadPool &pool, size_t parts, Body &body) {
+  std::mutex mutex;
+  std::condition_variable done;
+  size_t pending = parts - 1;
+  std::exception_ptr error;
+  auto finish = [&](std::exception_ptr e) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (e && !error) error = e;
+    if (--pending == 0) done.notify_one();
+  };
+  for (size_t i = 1; i < parts; ++i) {
+    pool.submit([&body, &finish, i] {
+      try {
+        body(i);
+      } catch (...) {
+        finish(std::current_exception());
+        return;
+      }
+      finish(nullptr);
+    });
+  }
+  try {
+    body(0);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!error) error = std::current_exception();
+  }
+  for (;;) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (pending == 0) break;
+    }
+    if (!pool.run_one()) {
+      std::unique_lock<std::mutex> lock(mutex);
+      done.wait(lock, [&] { return pending == 0; });
+      break;
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// The segment boundaries of a container, one segment per thread at most.
+template <class Container>
+auto segments(Container &c, size_t grain, const ThreadPool &pool) {
+  auto &range = contents(c, 0);
+  size_t parts = pool.size() + 1;
+  if constexpr (std::is_const_v<std::remove_reference_t<decltype(range)>>) {
+    return split(range.cbegin(), range.cend(), range.size(), grain, parts);
+  } else {
+    return split(range.begin(), range.end(), range.size(), grain, parts);
+  }
+}
+
+// Calls segment(i, first, last) for every segment i of cuts.
+template <class Iterator, class Segment>
+void for_segments(ThreadPool &pool, const Vector<Iterator> &cuts,
+                  Segment segment) {
+  auto body = [&](size_t i) { segment(i, cuts[i], cuts[i + 1]); };
+  run(pool, cuts.size() - 1, body);
+}
+
+}  // namespace internal
+
+template <class Container, class Function>
+void for_each(Container &c, Function f, size_t grain = kDefaultGrain,
+              ThreadPool &pool = ThreadPool::shared()) {
+  internal::for_segments(pool, internal::segments(c, grain, pool),
+                         [&f](size_t, auto first, auto last) {
+                           for (; first != last; ++first) f(*first);
+                         });
+}  // Calls f on every element
+
+template <class Container, class UnaryOperation>
+void transform_inplace(Container &c, UnaryOperation op,
+                       size_t grain = kDefaultGrain,
+                       ThreadPool &pool = ThreadPool::shared()) {
+  internal::for_segments(pool, internal::segments(c, grain, pool),
+                         [&op](size_t, auto first, auto last) {
+                           for (; first != last; ++first) *first = op(*first);
+                         });
+}  // Replaces every element with op of it
+
+template <class Container, class T, class BinaryOperation = std::plus<>>
+T reduce(const Container &c, T init, BinaryOperation op = BinaryOperation(),
+         size_t grain = kDefaultGrain,
+         ThreadPool &pool = ThreadPool::shared()) {
+  auto cuts = internal::segments(c, grain, pool);
+  Vector<std::optional<T>> partial(cuts.size() - 1);
+  internal::for_segments(
+      pool, cuts, [&op, &partial](size_t i, auto first, auto last) {
+        if (first == last) return;
+        T sum = *first;
+        for (++first; first != last; ++first) sum = op(std::move(sum), *first);
+        partial[i] = std::move(sum);
+      });
+  for (std::optional<T> &sum : partial) {
+    if (sum) init = op(std::move(init), std::move(*sum));
+  }
+  return init;
+}  // Folds the elements into init with op, which must be associative: each
+   // segment is folded on its own and the results are folded in order
+
+template <class Container, class Predicate>
+size_t count_if(const Container &c, Predicate pred,
+                size_t grain = kDefaultGrain,
+                ThreadPool &pool = ThreadPool::shared()) {
+  auto cuts = internal::segments(c, grain, pool);
+  Vector<size_t> counts(cuts.size() - 1);
+  internal::for_segments(
+      pool, cuts, [&pred, &counts](size_t i, auto first, auto last) {
+        size_t n = 0;
+        for (; first != last; ++first) n += pred(*first) ? 1 : 0;
+        counts[i] = n;
+      });
+  size_t total = 0;
+  for (size_t n : counts) total += n;
+  return total;
+}  // Returns the number of elements satisfying pred
+
+namespace internal {
+
+// The segments are spliced off into lists of their own and sorted
+// concurrently. Sorted runs are then merged pairwise, again concurrently,
+// and the last run is spliced back; merging and splicing only relink nodes.
+// As with List::sort, comparisons must not throw.
+template <class T, class Allocator, class Stats, class SortRun,
+          class Compare>
+void sort_list(List<T, Allocator, Stats> &list, size_t grain,
+               ThreadPool &pool, SortRun sort_run, Compare comp) {
+  using list_type = List<T, Allocator, Stats>;
+  auto cuts = split(list.cbegin(), list.cend(), list.size(), grain,
+                    pool.size() + 1);
+  size_t parts = cuts.size() - 1;
+  if (parts == 1) {
+    sort_run(list);
+    return;
+  }
+  Vector<list_type> runs;
+  runs.reserve(parts);
+  for (size_t i = 0; i < parts; ++i) runs.emplace_back(list.get_allocator());
+  for (size_t i = 0; i + 1 < parts; ++i) {
+    runs[i].splice(runs[i].cend(), list, cuts[i], cuts[i + 1]);
+  }
+  runs[parts - 1].splice(runs[parts - 1].cend(), list);
+  auto sort_body = [&](size_t i) { sort_run(runs[i]); };
+  run(pool, parts, sort_body);
+  for (size_t step = 1; step < parts; step *= 2) {
+    size_t merges = (parts - step + 2 * step - 1) / (2 * step);
+    auto merge_body = [&](size_t i) {
+      runs[2 * step * i].merge(runs[2 * step * i + step], comp);
+    };
+    run(pool, merges, merge_body);
+  }
+  list.splice(list.cend(), runs[0]);
+}
+
+}  // namespace internal
+
+template <class T, class Allocator, class Stats>
+void sort(List<T, Allocator, Stats> &list, size_t grain = kDefaultGrain,
+          ThreadPool &pool = ThreadPool::shared()) {
+  internal::sort_list(
+      list, grain, pool, [](List<T, Allocator, Stats> &run) { run.sort(); },
+      std::less<T>());
+}  // Stably sorts the list; each run is sorted as List::sort() would,
+   // radix sorting arithmetic types
+
+template <class T, class Allocator, class Stats, class Compare,
+          class = std::enable_if_t<!std::is_integral_v<Compare>>>
+void sort(List<T, Allocator, Stats> &list, Compare comp,
+          size_t grain = kDefaultGrain,
+          ThreadPool &pool = ThreadPool::shared()) {
+  internal::sort_list(
+      list, grain, pool,
+      [&comp](List<T, Allocator, Stats> &run) { run.sort(comp); }, comp);
+}  // Stably sorts the list with respect to comp
+
+}  // namespace parallel
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_PARALLEL_H_
@@ -0,0 +1,170 @@
+#ifndef SRC_MY_POOL_ALLOCATOR_H_
+#define SRC_MY_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace mynamespace {
+
+// Slab allocator for small fixed-size objects such as list nodes. Memory is
+// carved out of large contiguous blocks and freed chunks are kept on a
+// per-size free list, so steady push/pop churn never reaches the global heap.
+// Blocks are returned to the system only when the resource is destroyed.
+// A resource is not thread-safe.
+class PoolResource {
+ public:
+  static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+  static constexpr std::size_t kMaxChunkSize =
+      16 * kAlignment;  // Larger or over-aligned requests go to operator new
+  static constexpr std::size_t kBlockSize = 64 * 1024;  // Bytes per slab
+
+  PoolResource() noexcept = default;
+  PoolResource(const PoolResource &) = delete;
+  PoolResource &operator=(const PoolResource &) = delete;
+  ~PoolResource() { release(); }
+
+  void *allocate(std::size_t bytes, std::size_t alignment) {
+    if (!pooled(bytes, alignment)) {
+      if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(bytes, std::align_val_t{alignment});
+      }
+      return ::operator new(bytes);
+    }
+    SizeClass &sc = classes_[class_index(bytes)];
+    if (sc.free_) {
+      FreeChunk *chunk = sc.free_;
+      sc.free_ = chunk->next_;
+      return chunk;
+    }
+    std::size_t chunk_size = (class_index(bytes) + 1) * kAlignment;
+    if (sc.cursor_ == sc.end_) refill(sc, chunk_size);
+    void *p = sc.cursor_;
+    sc.cursor_ += chunk_size;
+    return p;
+  }
+
+  void deallocate(void *p, std::size_t bytes, std::size_t alignment) noexcept {
+    if (!pooled(bytes, alignment)) {
+      if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(p, std::align_val_t{alignment});
+      } else {
+        ::operator delete(p);
+      }
+      return;
+    }
+    SizeClass &sc = classes_[class_index(bytes)];
+    FreeChunk *chunk = static_cast<FreeChunk *>(p);
+    chunk->next_ = sc.free_;
+    sc.free_ = chunk;
+  }
+
+  // Returns every block to the system. All chunks become invalid.
+  void release() noexcept {
+    while (blocks_) {
+      Block *next = blocks_->next_;
+      ::operator delete(blocks_);
+      blocks_ = next;
+    }
+    for (SizeClass &sc : classes_) sc = SizeClass();
+  }
+
+ private:
+  struct FreeChunk {
+    FreeChunk *next_;
+  };
+
+  struct alignas(std::max_align_t) Block {
+    Block *next_;
+  };
+
+  struct SizeClass {
+    FreeChunk *free_ = nullptr;
+    char *cursor_ = nullptr;
+    char *end_ = nullptr;
+  };
+
+  static bool pooled(std::size_t bytes, std::size_t alignment) noexcept {
+    return bytes != 0 && bytes <= kMaxChunkSize && alignment <= kAlignment;
+  }
+
+  static std::size_t class_index(std::size_t bytes) noexcept {
+    return (bytes + kAlignment - 1) / kAlignment - 1;
+  }
+
+  void refill(SizeClass &sc, std::size_t chunk_size) {
+    Block *block = static_cast<Block *>(::operator new(kBlockSize));
+    block->next_ = blocks_;
+    blocks_ = block;
+    char *begin = reinterpret_cast<char *>(block) + sizeof(Block);
+    sc.cursor_ = begin;
+    sc.end_ = begin + (kBlockSize - sizeof(Block)) / chunk_size * chunk_size;
+  }
+
+  SizeClass classes_[kMaxChunkSize / kAlignment];
+  Block *blocks_ = nullptr;
+};
+
+// Allocator that hands out memory from a PoolResource. Copies and rebound
+// copies share the same resource, so a container can rebind it to its node
+// type. A copy-constructed container gets a fresh resource of its own.
+// Moving copies too: a moved-from container must still be able to allocate
+// and free through an allocator equal to the one it handed over.
+template <class T>
+class PoolAllocator {
+ public:
+  // Member types
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  PoolAllocator() : pool_(std::make_shared<PoolResource>()) {}
+  PoolAllocator(const PoolAllocator &other) noexcept = default;
+  PoolAllocator &operator=(const PoolAllocator &other) noexcept = default;
+
+  template <class U>
+  PoolAllocator(const PoolAllocator<U> &other) noexcept : pool_(other.pool_) {}
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    return static_cast<T *>(pool_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    pool_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  size_type max_size() const noexcept {
+    return static_cast<size_type>(PTRDIFF_MAX) / sizeof(T);
+  }
+
+  PoolAllocator select_on_container_copy_construction() const {
+    return PoolAllocator();
+  }
+
+  template <class U>
+  bool operator==(const PoolAllocator<U> &other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+  template <class U>
+  bool operator!=(const PoolAllocator<U> &other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <class U>
+  friend class PoolAllocator;
+
+  std::shared_ptr<PoolResource> pool_;
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_POOL_ALLOCATOR_H_
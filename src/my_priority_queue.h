@@ -0,0 +1,457 @@
+#ifndef SRC_MY_PRIORITY_QUEUE_H_
+#define SRC_MY_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "my_stats.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// A priority queue kept as a 4-ary max-heap in a contiguous container: top()
+// is the greatest element under Compare. With four children per node the
+// heap is half as deep as a binary one, and the children compared while
+// sifting down sit next to each other in memory.
+template <class T, class Container = mynamespace::Vector<T>,
+          class Compare = std::less<typename Container::value_type>,
+          class Stats = DefaultStats>
+class PriorityQueue : private AdapterStats<Stats> {
+  using stats_base = AdapterStats<Stats>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Member types
+  using container_type = Container;  // The type of the underlying container
+  using value_compare = Compare;     // The type of the ordering
+  using value_type = typename Container::value_type;  // The type of an element
+  using reference =
+      typename Container::reference;  // The type of the reference to an element
+  using const_reference =
+      typename Container::const_reference;  // The type of the constant
+                                            // reference to an element
+  using size_type =
+      typename Container::size_type;  // The type of the container size
+
+  static constexpr size_type kArity = 4;  // Children per heap node
+
+  // Member functions
+  PriorityQueue() : PriorityQueue(Compare()) {}  // Default constructor
+
+  explicit PriorityQueue(const Compare &compare)
+      : stats_base("PriorityQueue"),
+        comp_(compare),
+        c_() {}  // Comparator constructor
+
+  explicit PriorityQueue(std::initializer_list<value_type> const &items,
+                         const Compare &compare = Compare())
+      : stats_base("PriorityQueue"), comp_(compare), c_(items) {
+    heapify();
+    stats_base::on_size(c_.size());
+  }  // Initializer list constructor, heapified in O(n)
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  PriorityQueue(InputIt first, InputIt last,
+                const Compare &compare = Compare())
+      : PriorityQueue(compare) {
+    append_range(c_, first, last, 0);
+    heapify();
+    stats_base::on_size(c_.size());
+  }  // Range constructor, heapified in O(n)
+
+  PriorityQueue(const PriorityQueue &q)
+      : stats_base("PriorityQueue"),
+        comp_(q.comp_),
+        c_(q.c_) {}  // Copy constructor
+
+  PriorityQueue(PriorityQueue &&q)
+      : stats_base("PriorityQueue"),
+        comp_(std::move(q.comp_)),
+        c_(std::move(q.c_)) {}  // Move constructor
+
+  ~PriorityQueue() {}  // Destructor
+
+  PriorityQueue &operator=(PriorityQueue &&q) {
+    comp_ = std::move(q.comp_);
+    c_ = std::move(q.c_);
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  // Element access
+
+  const_reference top() const { return c_[0]; }  // Accesses the top element
+
+  // Capacity
+
+  bool empty() const {
+    return c_.empty();
+  }  // Checks whether the container is empty
+
+  size_type size() const {
+    return c_.size();
+  }  // Returns the number of elements
+
+  // Modifiers
+
+  void push(const_reference value) {
+    c_.push_back(value);
+    sift_up(c_.size() - 1);
+    pushed(1);
+  }  // Inserts element and restores the heap order
+
+  void push(value_type &&value) {
+    c_.push_back(std::move(value));
+    sift_up(c_.size() - 1);
+    pushed(1);
+  }  // Moves element in and restores the heap order
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+    sift_up(c_.size() - 1);
+    pushed(1);
+  }  // Constructs element in-place and restores the heap order
+
+  void pop() {
+    if (!empty()) {
+      size_type last = c_.size() - 1;
+      if (last > 0) {
+        size_type hole = 0;
+        for (size_type first = 1; first < last; first = hole * kArity + 1) {
+          size_type best = max_child(first, last);
+          c_[hole] = std::move(c_[best]);
+          hole = best;
+        }
+        if (hole != last) {
+          c_[hole] = std::move(c_[last]);
+          sift_up(hole);
+        }
+      }
+      c_.pop_back();
+      stats_base::on_call(StatsOp::kPop);
+    }
+  }  // Removes the top element, if any: its hole sinks to a leaf along the
+     // greater children and the last element fills it from below, which
+     // takes fewer comparisons than sifting the last element down from the
+     // root
+
+  void swap(PriorityQueue &other) noexcept {
+    std::swap(comp_, other.comp_);
+    std::swap(c_, other.c_);
+  }  // Swaps the contents
+
+  // Bonus
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    size_type before = c_.size();
+    c_.insert_many_back(std::forward<Args>(args)...);
+    restore(before);
+    pushed(sizeof...(Args));
+  }  // Inserts new elements and restores the heap order once
+
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type before = c_.size();
+    append_range(c_, first, last, 0);
+    restore(before);
+    pushed(c_.size() - before);
+  }  // Inserts [first, last) and restores the heap order once
+
+  // Instrumentation
+
+  ContainerStats stats() const noexcept {
+    ContainerStats s = stats_base::snapshot();
+    if constexpr (has_stats_v<Container>) s += c_.stats();
+    return s;
+  }  // Returns the adapter's counters merged with the container's
+
+ private:
+  void sift_up(size_type i) {
+    value_type value = std::move(c_[i]);
+    while (i > 0) {
+      size_type parent = (i - 1) / kArity;
+      if (!comp_(c_[parent], value)) break;
+      c_[i] = std::move(c_[parent]);
+      i = parent;
+    }
+    c_[i] = std::move(value);
+  }  // Moves the element at i up to its place
+
+  void sift_down(size_type i) {
+    size_type n = c_.size();
+    value_type value = std::move(c_[i]);
+    for (size_type first = i * kArity + 1; first < n;
+         first = i * kArity + 1) {
+      size_type best = max_child(first, n);
+      if (!comp_(value, c_[best])) break;
+      c_[i] = std::move(c_[best]);
+      i = best;
+    }
+    c_[i] = std::move(value);
+  }  // Moves the element at i down to its place
+
+  size_type max_child(size_type first, size_type n) const {
+    if (n - first >= kArity) {
+      size_type left = first + comp_(c_[first], c_[first + 1]);
+      size_type right = first + 2 + comp_(c_[first + 2], c_[first + 3]);
+      return comp_(c_[left], c_[right]) ? right : left;
+    }
+    size_type best = first;
+    for (size_type child = first + 1; child < n; ++child) {
+      if (comp_(c_[best], c_[child])) best = child;
+    }
+    return best;
+  }  // Index of the greatest of the children starting at first, a full set
+     // compared as a tournament whose branches the compiler can flatten
+
+  void heapify() {
+    size_type n = c_.size();
+    if (n < 2) return;
+    for (size_type i = (n - 2) / kArity + 1; i-- > 0;) sift_down(i);
+  }  // Floyd's bottom-up construction, O(n)
+
+  void restore(size_type before) {
+    size_type n = c_.size();
+    if (n - before > before) {
+      heapify();
+    } else {
+      for (size_type i = before; i < n; ++i) sift_up(i);
+    }
+  }  // Restores the order after appending [before, size()): rebuilds when
+     // the new elements outnumber the old ones, sifts each up otherwise
+
+  template <class C, class InputIt>
+  static auto append_range(C &c, InputIt first, InputIt last, int)
+      -> decltype(c.insert(c.cend(), first, last), void()) {
+    c.insert(c.cend(), first, last);
+  }  // Range insert of containers such as List
+
+  template <class C, class InputIt>
+  static void append_range(C &c, InputIt first, InputIt last, long) {
+    for (; first != last; ++first) c.push_back(*first);
+  }  // Element by element for the others
+
+  void pushed(size_type n) noexcept {
+    stats_base::on_call(StatsOp::kPush, n);
+    stats_base::on_size(c_.size());
+  }  // Records n pushes and the new size
+
+  Compare comp_;
+  Container c_;
+};
+
+// The same 4-ary heap, with a handle returned by every push that can later
+// change the element's priority or remove it in O(log n), as rescheduled
+// timers and Dijkstra's algorithm need. A handle stays valid until its
+// element is popped or erased; after that it may be reused for a new one.
+template <class T, class Compare = std::less<T>, class Stats = DefaultStats>
+class HandlePriorityQueue : private AdapterStats<Stats> {
+  using stats_base = AdapterStats<Stats>;
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;  // The type of the constant reference to an element
+  using value_compare = Compare;  // The type of the ordering
+  using size_type = size_t;       // The type of the container size
+  using handle_type = size_t;     // Identifies an element while queued
+
+  static constexpr size_type kArity = 4;  // Children per heap node
+
+  // Member functions
+  HandlePriorityQueue()
+      : HandlePriorityQueue(Compare()) {}  // Default constructor
+
+  explicit HandlePriorityQueue(const Compare &compare)
+      : stats_base("PriorityQueue"),
+        comp_(compare) {}  // Comparator constructor
+
+  HandlePriorityQueue(const HandlePriorityQueue &q)
+      : stats_base("PriorityQueue"),
+        comp_(q.comp_),
+        heap_(q.heap_),
+        position_(q.position_),
+        free_(q.free_) {}  // Copy constructor, handles stay valid
+
+  HandlePriorityQueue(HandlePriorityQueue &&q)
+      : stats_base("PriorityQueue"),
+        comp_(std::move(q.comp_)),
+        heap_(std::move(q.heap_)),
+        position_(std::move(q.position_)),
+        free_(std::move(q.free_)) {}  // Move constructor, handles stay valid
+
+  ~HandlePriorityQueue() {}  // Destructor
+
+  HandlePriorityQueue &operator=(HandlePriorityQueue &&q) {
+    comp_ = std::move(q.comp_);
+    heap_ = std::move(q.heap_);
+    position_ = std::move(q.position_);
+    free_ = std::move(q.free_);
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  // Element access
+
+  const_reference top() const {
+    return heap_[0].value;
+  }  // Accesses the top element
+
+  handle_type top_handle() const {
+    return heap_[0].handle;
+  }  // Returns the handle of the top element
+
+  const_reference value(handle_type handle) const {
+    return heap_[position_[handle]].value;
+  }  // Accesses the element behind a handle
+
+  bool contains(handle_type handle) const noexcept {
+    return handle < position_.size() && position_[handle] != kFree;
+  }  // Checks whether the handle refers to a queued element
+
+  // Capacity
+
+  bool empty() const noexcept {
+    return heap_.empty();
+  }  // Checks whether the container is empty
+
+  size_type size() const noexcept {
+    return heap_.size();
+  }  // Returns the number of elements
+
+  // Modifiers
+
+  handle_type push(const_reference value) {
+    return emplace(value);
+  }  // Inserts element and returns its handle
+
+  handle_type push(value_type &&value) {
+    return emplace(std::move(value));
+  }  // Moves element in and returns its handle
+
+  template <class... Args>
+  handle_type emplace(Args &&...args) {
+    handle_type handle = acquire();
+    try {
+      heap_.emplace_back(
+          Entry{value_type(std::forward<Args>(args)...), handle});
+    } catch (...) {
+      free_.push_back(handle);
+      throw;
+    }
+    position_[handle] = heap_.size() - 1;
+    sift_up(heap_.size() - 1);
+    stats_base::on_call(StatsOp::kPush);
+    stats_base::on_size(heap_.size());
+    return handle;
+  }  // Constructs element in-place and returns its handle
+
+  void pop() {
+    if (!empty()) {
+      erase(top_handle());
+      stats_base::on_call(StatsOp::kPop);
+    }
+  }  // Removes the top element and releases its handle, if any
+
+  void update(handle_type handle, const_reference value) {
+    size_type i = position_[handle];
+    bool raised = comp_(heap_[i].value, value);
+    heap_[i].value = value;
+    raised ? sift_up(i) : sift_down(i);
+  }  // Replaces the element behind a handle, moving it up (decrease-key for
+     // a min-heap) or down as its new priority requires
+
+  void erase(handle_type handle) {
+    size_type i = position_[handle];
+    size_type last = heap_.size() - 1;
+    if (i != last) {
+      heap_[i] = std::move(heap_[last]);
+      position_[heap_[i].handle] = i;
+    }
+    heap_.pop_back();
+    position_[handle] = kFree;
+    free_.push_back(handle);
+    if (i != last) {
+      handle_type moved = heap_[i].handle;
+      sift_up(i);
+      if (position_[moved] == i) sift_down(i);
+    }
+  }  // Removes the element behind a handle and releases the handle
+
+  void swap(HandlePriorityQueue &other) noexcept {
+    std::swap(comp_, other.comp_);
+    heap_.swap(other.heap_);
+    position_.swap(other.position_);
+    free_.swap(other.free_);
+  }  // Swaps the contents; handles follow their elements
+
+ private:
+  struct Entry {
+    value_type value;
+    handle_type handle;
+  };
+
+  static constexpr size_type kFree =
+      std::numeric_limits<size_type>::max();  // Position of a free handle
+
+  handle_type acquire() {
+    if (!free_.empty()) {
+      handle_type handle = free_.back();
+      free_.pop_back();
+      return handle;
+    }
+    position_.push_back(kFree);
+    return position_.size() - 1;
+  }  // Reuses a released handle or makes a new one
+
+  void place(size_type i, Entry &&entry) {
+    heap_[i] = std::move(entry);
+    position_[heap_[i].handle] = i;
+  }  // Stores entry at heap index i and records its position
+
+  void sift_up(size_type i) {
+    Entry entry = std::move(heap_[i]);
+    while (i > 0) {
+      size_type parent = (i - 1) / kArity;
+      if (!comp_(heap_[parent].value, entry.value)) break;
+      place(i, std::move(heap_[parent]));
+      i = parent;
+    }
+    place(i, std::move(entry));
+  }  // Moves the entry at i up to its place
+
+  void sift_down(size_type i) {
+    size_type n = heap_.size();
+    Entry entry = std::move(heap_[i]);
+    for (size_type first = i * kArity + 1; first < n;
+         first = i * kArity + 1) {
+      size_type last = n - first < kArity ? n : first + kArity;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; ++child) {
+        if (comp_(heap_[best].value, heap_[child].value)) best = child;
+      }
+      if (!comp_(entry.value, heap_[best].value)) break;
+      place(i, std::move(heap_[best]));
+      i = best;
+    }
+    place(i, std::move(entry));
+  }  // Moves the entry at i down to its place
+
+  Compare comp_;
+  Vector<Entry> heap_;          // The heap of values and their handles
+  Vector<size_type> position_;  // Heap index by handle, kFree if unused
+  Vector<handle_type> free_;    // Released handles
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_PRIORITY_QUEUE_H_
@@ -1,14 +1,23 @@
 #ifndef SRC_MY_QUEUE_H_
 #define SRC_MY_QUEUE_H_
 
+#include <string>
+
+#include "my_archive.h"
+#include "my_deque.h"
 #include "my_list.h"
+#include "my_stats.h"
 
 namespace mynamespace {
 
-template <class T, class Container = mynamespace::List<T>>
-class Queue {
+template <class T, class Container = mynamespace::Deque<T>,
+          class Stats = DefaultStats>
+class Queue : private AdapterStats<Stats> {
+  using stats_base = AdapterStats<Stats>;
+
  public:
   // Member types
+  using container_type = Container;  // The type of the underlying container
   using value_type = typename Container::value_type;  // The type of an element
   using reference =
       typename Container::reference;  // The type of the reference to an element
@@ -19,14 +28,18 @@ class Queue {
       typename Container::size_type;  // The type of the container size
 
   // Member functions
-  Queue() : c_() {}  // Default constructor
+  Queue() : stats_base("Queue"), c_() {}  // Default constructor
 
   explicit Queue(std::initializer_list<value_type> const &items)
-      : c_(items) {}  // Initializer list constructor
+      : stats_base("Queue"), c_(items) {
+    stats_base::on_size(c_.size());
+  }  // Initializer list constructor
 
-  Queue(const Queue &q) : c_(q.c_) {}  // Copy constructor
+  Queue(const Queue &q)
+      : stats_base("Queue"), c_(q.c_) {}  // Copy constructor
 
-  Queue(Queue &&q) : c_(std::move(q.c_)) {}  // Move constructor
+  Queue(Queue &&q)
+      : stats_base("Queue"), c_(std::move(q.c_)) {}  // Move constructor
 
   ~Queue() {}  // Destructor
 
@@ -56,10 +69,30 @@ class Queue {
   // Modifiers
 
   void push(const_reference value) {
-    return c_.push_back(value);
+    c_.push_back(value);
+    pushed(1);
   }  // Inserts element at the end
 
-  void pop() { return c_.pop_front(); };  // Removes the first element
+  void push(value_type &&value) {
+    c_.push_back(std::move(value));
+    pushed(1);
+  }  // Moves element to the end
+
+  void push(reference value) {
+    c_.push_back(value);
+    pushed(1);
+  }  // Inserts element at the end; an intrusive container links value itself
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+    pushed(1);
+  }  // Constructs element in-place at the end
+
+  void pop() {
+    c_.pop_front();
+    stats_base::on_call(StatsOp::kPop);
+  };  // Removes the first element
 
   void swap(Queue &other) noexcept {
     std::swap(c_, other.c_);
@@ -67,10 +100,61 @@ class Queue {
 
   template <class... Args>
   void insert_many_back(Args &&...args) {
-    return c_.insert_many_back(args...);
+    c_.insert_many_back(std::forward<Args>(args)...);
+    pushed(sizeof...(Args));
   }  // Appends new elements to the end of the container
 
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type before = c_.size();
+    append_range(c_, first, last, 0);
+    pushed(c_.size() - before);
+  }  // Pushes [first, last) in order, in one bulk insert if the container
+     // has one
+
+  // Serialization
+
+  void save(const std::string &path) const {
+    archive::save(c_, path);
+  }  // Writes the elements to an archive at path, front to back
+
+  void load(const std::string &path) {
+    archive::load(c_, path);
+    stats_base::on_size(c_.size());
+  }  // Replaces the elements with those of the archive at path
+
+  container_type &container() noexcept {
+    return c_;
+  }  // The underlying container, front to back, for algorithms over all the
+     // elements such as those of parallel::
+
+  const container_type &container() const noexcept { return c_; }
+
+  // Instrumentation
+
+  ContainerStats stats() const noexcept {
+    ContainerStats s = stats_base::snapshot();
+    if constexpr (has_stats_v<Container>) s += c_.stats();
+    return s;
+  }  // Returns the adapter's counters merged with the container's
+
  private:
+  template <class C, class InputIt>
+  static auto append_range(C &c, InputIt first, InputIt last, int)
+      -> decltype(c.insert(c.cend(), first, last), void()) {
+    c.insert(c.cend(), first, last);
+  }  // Range insert of containers such as List
+
+  template <class C, class InputIt>
+  static void append_range(C &c, InputIt first, InputIt last, long) {
+    for (; first != last; ++first) c.push_back(*first);
+  }  // Element by element for the others
+
+  void pushed(size_type n) noexcept {
+    stats_base::on_call(StatsOp::kPush, n);
+    stats_base::on_size(c_.size());
+  }  // Records n pushes and the new size
+
   Container c_;
 };
 
@@ -0,0 +1,348 @@
+#ifndef SRC_MY_RING_QUEUE_H_
+#define SRC_MY_RING_QUEUE_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mynamespace {
+
+// Capacity value that selects a ring whose size is given at construction.
+constexpr size_t kDynamicCapacity = 0;
+
+// Smallest power of two that is not less than n.
+constexpr size_t ring_slots(size_t n) {
+  size_t slots = 1;
+  while (slots < n) slots *= 2;
+  return slots;
+}
+
+// Element storage of a RingQueue: inline for a compile-time capacity.
+template <class T, size_t Capacity>
+class RingStorage {
+ public:
+  static constexpr size_t kSlots = ring_slots(Capacity);
+
+  RingStorage() noexcept = default;
+  explicit RingStorage(size_t) noexcept {}
+  RingStorage(const RingStorage &) noexcept {}
+
+  T *slots() noexcept { return reinterpret_cast<T *>(storage_); }
+  const T *slots() const noexcept {
+    return reinterpret_cast<const T *>(storage_);
+  }
+  size_t capacity() const noexcept { return Capacity; }
+  size_t mask() const noexcept { return kSlots - 1; }
+  void swap_buffer(RingStorage &) noexcept {}
+
+  static constexpr bool kMovesBuffer = false;
+
+ private:
+  alignas(T) unsigned char storage_[kSlots * sizeof(T)];
+};
+
+// Element storage of a RingQueue: one heap buffer allocated at construction.
+// A moved-from buffer has no capacity.
+template <class T>
+class RingStorage<T, kDynamicCapacity> {
+ public:
+  explicit RingStorage(size_t capacity)
+      : capacity_(capacity),
+        mask_(ring_slots(capacity) - 1),
+        slots_(std::allocator<T>().allocate(mask_ + 1)) {}
+  RingStorage(const RingStorage &other) : RingStorage(other.capacity_) {}
+  RingStorage(RingStorage &&other) noexcept
+      : capacity_(other.capacity_), mask_(other.mask_), slots_(other.slots_) {
+    other.capacity_ = other.mask_ = 0;
+    other.slots_ = nullptr;
+  }
+  ~RingStorage() {
+    if (slots_) std::allocator<T>().deallocate(slots_, mask_ + 1);
+  }
+
+  T *slots() noexcept { return slots_; }
+  const T *slots() const noexcept { return slots_; }
+  size_t capacity() const noexcept { return capacity_; }
+  size_t mask() const noexcept { return mask_; }
+  void swap_buffer(RingStorage &other) noexcept {
+    std::swap(capacity_, other.capacity_);
+    std::swap(mask_, other.mask_);
+    std::swap(slots_, other.slots_);
+  }
+
+  static constexpr bool kMovesBuffer = true;
+
+ private:
+  size_t capacity_;
+  size_t mask_;
+  T *slots_;
+};
+
+// Bounded FIFO queue over a single preallocated buffer. The buffer holds a
+// power-of-two number of slots, so positions are wrapped with a mask instead
+// of a division. Nothing is allocated after construction: push throws when
+// the queue is full, try_push reports it through its return value instead.
+// RingQueue<T, N> keeps its buffer inline; RingQueue<T> takes its capacity
+// as a constructor argument.
+template <class T, size_t Capacity = kDynamicCapacity>
+class RingQueue : private RingStorage<T, Capacity> {
+  using storage = RingStorage<T, Capacity>;
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+
+  // Member functions
+  RingQueue() = default;  // Default constructor (compile-time capacity)
+  explicit RingQueue(size_type capacity);  // Constructor (runtime capacity)
+  RingQueue(std::initializer_list<value_type> const
+                &items);        // Initializer list constructor
+  RingQueue(const RingQueue &q);  // Copy constructor
+  RingQueue(RingQueue &&q) noexcept(
+      storage::kMovesBuffer);  // Move constructor
+  ~RingQueue();                // Destructor
+  RingQueue &operator=(RingQueue &&q) noexcept(
+      storage::kMovesBuffer);  // Assignment operator overload for moving object
+
+  // Element access
+  const_reference front() const;  // Access the first element
+  const_reference back() const;   // Access the last element
+
+  // Capacity
+  bool empty() const noexcept;  // Checks whether the container is empty
+  bool full() const noexcept;   // Checks whether the container is full
+  size_type size() const noexcept;      // Returns the number of elements
+  size_type capacity() const noexcept;  // Returns the maximum number of
+                                        // elements
+
+  // Modifiers
+  void push(const_reference value);  // Inserts element at the end
+  void push(value_type &&value);     // Moves element to the end
+  template <class... Args>
+  void emplace(Args &&...args);  // Constructs element in-place at the end
+  bool try_push(const_reference value);  // Inserts element unless full
+  bool try_push(value_type &&value);     // Moves element unless full
+  template <class... Args>
+  bool try_emplace(Args &&...args);  // Constructs element unless full
+  void pop();                        // Removes the first element, if any
+  bool try_pop(value_type &value);   // Moves out the first element unless
+                                     // empty
+  void clear() noexcept;             // Removes all elements
+  void swap(RingQueue &other) noexcept(
+      storage::kMovesBuffer);  // Swaps the contents
+
+  // Bonus
+
+  template <class... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+
+ private:
+  value_type *slot(size_type pos) noexcept;  // Storage for a position
+  const value_type *slot(size_type pos) const noexcept;
+
+  // attributes
+  size_type head_ = 0;  // Position of the first element
+  size_type tail_ = 0;  // Position past the last element
+};
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity>::RingQueue(size_type capacity)
+    : storage(capacity) {
+  static_assert(Capacity == kDynamicCapacity,
+                "Capacity is fixed by the template argument");
+}
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity>::RingQueue(
+    std::initializer_list<value_type> const &items)
+    : storage(items.size()) {
+  if (items.size() > capacity()) throw std::length_error("RingQueue is full");
+  for (const auto &item : items) push(item);
+}
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity>::RingQueue(const RingQueue &q) : storage(q) {
+  for (size_type pos = q.head_; pos != q.tail_; ++pos) push(*q.slot(pos));
+}
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity>::RingQueue(RingQueue &&q) noexcept(
+    storage::kMovesBuffer)
+    : storage(std::move(q)) {
+  if constexpr (storage::kMovesBuffer) {
+    std::swap(head_, q.head_);
+    std::swap(tail_, q.tail_);
+  } else {
+    for (size_type pos = q.head_; pos != q.tail_; ++pos) {
+      push(std::move(*q.slot(pos)));
+    }
+    q.clear();
+  }
+}
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity>::~RingQueue() {
+  clear();
+}
+
+template <class value_type, size_t Capacity>
+RingQueue<value_type, Capacity> &RingQueue<value_type, Capacity>::operator=(
+    RingQueue &&q) noexcept(storage::kMovesBuffer) {
+  if (this != &q) {
+    if constexpr (storage::kMovesBuffer) {
+      swap(q);
+    } else {
+      clear();
+      for (size_type pos = q.head_; pos != q.tail_; ++pos) {
+        push(std::move(*q.slot(pos)));
+      }
+    }
+    q.clear();
+  }
+  return *this;
+}
+
+// Element access
+
+template <class value_type, size_t Capacity>
+typename RingQueue<value_type, Capacity>::const_reference
+RingQueue<value_type, Capacity>::front() const {
+  return *slot(head_);
+}
+
+template <class value_type, size_t Capacity>
+typename RingQueue<value_type, Capacity>::const_reference
+RingQueue<value_type, Capacity>::back() const {
+  return *slot(tail_ - 1);
+}
+
+// Capacity
+
+template <class value_type, size_t Capacity>
+bool RingQueue<value_type, Capacity>::empty() const noexcept {
+  return head_ == tail_;
+}
+
+template <class value_type, size_t Capacity>
+bool RingQueue<value_type, Capacity>::full() const noexcept {
+  return size() == capacity();
+}
+
+template <class value_type, size_t Capacity>
+typename RingQueue<value_type, Capacity>::size_type
+RingQueue<value_type, Capacity>::size() const noexcept {
+  return tail_ - head_;
+}
+
+template <class value_type, size_t Capacity>
+typename RingQueue<value_type, Capacity>::size_type
+RingQueue<value_type, Capacity>::capacity() const noexcept {
+  return storage::capacity();
+}
+
+// Modifiers
+
+template <class value_type, size_t Capacity>
+void RingQueue<value_type, Capacity>::push(const_reference value) {
+  emplace(value);
+}
+
+template <class value_type, size_t Capacity>
+void RingQueue<value_type, Capacity>::push(value_type &&value) {
+  emplace(std::move(value));
+}
+
+template <class value_type, size_t Capacity>
+template <class... Args>
+void RingQueue<value_type, Capacity>::emplace(Args &&...args) {
+  if (!try_emplace(std::forward<Args>(args)...)) {
+    throw std::length_error("RingQueue is full");
+  }
+}
+
+template <class value_type, size_t Capacity>
+bool RingQueue<value_type, Capacity>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <class value_type, size_t Capacity>
+bool RingQueue<value_type, Capacity>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <class value_type, size_t Capacity>
+template <class... Args>
+bool RingQueue<value_type, Capacity>::try_emplace(Args &&...args) {
+  if (full()) return false;
+  ::new (static_cast<void *>(slot(tail_)))
+      value_type(std::forward<Args>(args)...);
+  ++tail_;
+  return true;
+}
+
+template <class value_type, size_t Capacity>
+void RingQueue<value_type, Capacity>::pop() {
+  if (!empty()) {
+    slot(head_)->~value_type();
+    ++head_;
+  }
+}
+
+template <class value_type, size_t Capacity>
+bool RingQueue<value_type, Capacity>::try_pop(value_type &value) {
+  if (empty()) return false;
+  value = std::move(*slot(head_));
+  pop();
+  return true;
+}
+
+template <class value_type, size_t Capacity>
+void RingQueue<value_type, Capacity>::clear() noexcept {
+  while (!empty()) pop();
+  head_ = tail_ = 0;
+}
+
+template <class value_type, size_t Capacity>
+void RingQueue<value_type, Capacity>::swap(RingQueue &other) noexcept(
+    storage::kMovesBuffer) {
+  if constexpr (storage::kMovesBuffer) {
+    storage::swap_buffer(other);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+  } else {
+    RingQueue temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+}
+
+template <class value_type, size_t Capacity>
+template <class... Args>
+void RingQueue<value_type, Capacity>::insert_many_back(Args &&...args) {
+  if (sizeof...(args) > capacity() - size()) {
+    throw std::length_error("RingQueue is full");
+  }
+  (try_emplace(std::forward<Args>(args)), ...);
+}
+
+template <class value_type, size_t Capacity>
+value_type *RingQueue<value_type, Capacity>::slot(size_type pos) noexcept {
+  return storage::slots() + (pos & storage::mask());
+}
+
+template <class value_type, size_t Capacity>
+const value_type *RingQueue<value_type, Capacity>::slot(
+    size_type pos) const noexcept {
+  return storage::slots() + (pos & storage::mask());
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_RING_QUEUE_H_
@@ -0,0 +1,163 @@
+#ifndef SRC_MY_SET_H_
+#define SRC_MY_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "my_btree.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Sorted set of unique keys on a B-tree. Keys cannot be modified in place,
+// so iterator and const_iterator are the same type.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class Set : private BTree<Key, Key, Compare, Allocator, false> {
+  using tree = BTree<Key, Key, Compare, Allocator, false>;
+
+  template <class InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Member types
+  using key_type = Key;    // The type of a key
+  using value_type = Key;  // The type of an element
+  using reference =
+      value_type &;  // The type of the reference to an element
+  using const_reference =
+      const value_type &;  // The type of the constant reference to an element
+  using iterator =
+      typename tree::const_iterator;  // The type for iterating through the
+                                      // container, in key order
+  using const_iterator =
+      typename tree::const_iterator;  // The constant type for iterating
+                                      // through the container
+  using size_type = size_t;           // The type of the container size
+  using key_compare = Compare;        // The type of the key ordering
+  using allocator_type = Allocator;   // The type of the element allocator
+
+  // Member functions
+  Set() {}  // Default constructor
+
+  Set(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }  // Initializer list constructor
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  Set(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }  // Range constructor
+
+  Set(const Set &s) : tree(s) {}  // Copy constructor
+
+  Set(Set &&s) noexcept : tree(std::move(s)) {}  // Move constructor
+
+  ~Set() {}  // Destructor
+
+  Set &operator=(Set &&s) noexcept {
+    tree::operator=(std::move(s));
+    return *this;
+  }  // Assignment operator overload for moving object
+
+  using tree::get_allocator;
+  using tree::key_comp;
+
+  // Iterators
+
+  iterator begin() const noexcept {
+    return tree::cbegin();
+  }  // Returns an iterator to the smallest key
+
+  iterator end() const noexcept {
+    return tree::cend();
+  }  // Returns an iterator past the greatest key
+
+  using tree::cbegin;
+  using tree::cend;
+
+  // Capacity
+
+  using tree::empty;
+  using tree::max_size;
+  using tree::size;
+
+  // Modifiers
+
+  using tree::clear;
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree::emplace_key(value, value);
+  }  // Inserts value unless an equal key is present; invalidates iterators
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree::emplace_key(value, std::move(value));
+  }  // Moves value in unless an equal key is present
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree::emplace_value(std::forward<Args>(args)...);
+  }  // Constructs the key in-place and inserts it if it is new
+
+  iterator erase(iterator pos) {
+    return tree::erase(pos);
+  }  // Erases element at pos and returns the iterator to the next one
+
+  size_type erase(const key_type &key) {
+    return tree::erase(key);
+  }  // Erases key and returns the number of erased elements
+
+  void swap(Set &other) noexcept { tree::swap(other); }  // Swaps the contents
+
+  void merge(Set &other) {
+    tree::merge_from(other);
+  }  // Moves over the keys of other not yet present here
+
+  // Lookup
+
+  iterator find(const key_type &key) const {
+    return tree::find(key);
+  }  // Finds key
+
+  using tree::contains;
+  using tree::count;
+
+  iterator lower_bound(const key_type &key) const {
+    return tree::lower_bound(key);
+  }  // Returns the first key not less than key
+
+  iterator upper_bound(const key_type &key) const {
+    return tree::upper_bound(key);
+  }  // Returns the first key greater than key
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return tree::equal_range(key);
+  }  // Returns the range of keys equal to key
+
+  // Bonus
+
+  template <class... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    Vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (const value_type &item : items) {
+      result.push_back({iterator(), insert(item).second});
+    }
+    for (size_type i = 0; i < sizeof...(Args); ++i) {
+      result[i].first = find(items[i]);
+    }
+    return result;
+  }  // Inserts new elements; each result points at the element with that
+     // key once all are in, as every insert invalidates iterators
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_SET_H_
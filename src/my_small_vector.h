@@ -0,0 +1,503 @@
+#ifndef SRC_MY_SMALL_VECTOR_H_
+#define SRC_MY_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "my_vector_storage.h"
+
+namespace mynamespace {
+
+// A Vector whose first N elements live in a buffer inside the object, so a
+// container that never grows past N never touches the allocator. Past N the
+// elements move to the heap with the same geometric growth as Vector, and
+// shrink_to_fit brings them back once they fit again.
+template <class T, size_t N, class Allocator = std::allocator<T>>
+class SmallVector {
+  static_assert(N > 0, "SmallVector needs room for at least one element");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using allocator_type = Allocator;  // The type of the element allocator
+  using iterator = T *;  // The type for iterating through the container
+  using const_iterator =
+      const T *;  // The constant type for iterating through the container
+
+  static constexpr size_type inline_capacity =
+      N;  // The number of elements held without allocating
+
+  // Member functions
+  SmallVector();                                 // Default constructor
+  explicit SmallVector(const Allocator &alloc);  // Allocator constructor
+  explicit SmallVector(size_type n);             // Parameterized constructor
+  SmallVector(std::initializer_list<value_type> const
+                  &items);           // Initializer list constructor
+  SmallVector(const SmallVector &v);  // Copy constructor
+  SmallVector(SmallVector &&v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // Move constructor
+  ~SmallVector();                                     // Destructor
+  SmallVector &operator=(SmallVector &&v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // Assignment operator
+                                                      // overload for moving
+                                                      // object
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+
+  // Element access
+  reference at(size_type pos);  // Access specified element with bounds check
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);  // Access specified element
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;  // Access the first element
+  const_reference back() const;   // Access the last element
+  T *data() noexcept;             // Direct access to the underlying array
+  const T *data() const noexcept;
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the beginning
+  iterator end() noexcept;    // Returns an iterator to the end
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+  void reserve(size_type size);  // Makes room for size elements, moving to
+                                 // the heap if size exceeds N
+  size_type capacity() const noexcept;  // Returns the number of elements that
+                                        // can be held in current storage
+  void shrink_to_fit();  // Reduces memory usage, back to the inline buffer
+                         // if the elements fit in it
+
+  // Modifiers
+  void clear() noexcept;  // Clears the contents and keeps the storage
+  iterator insert(
+      iterator pos,
+      const_reference value);  // Inserts element into concrete pos and returns
+                               // the iterator that points to the new element
+  iterator insert(iterator pos,
+                  value_type &&value);  // Moves element into concrete pos
+  template <class... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // Constructs element in-place before pos
+  void erase(iterator pos);          // Erases element at pos
+  void push_back(const_reference value);  // Adds an element to the end
+  void push_back(value_type &&value);     // Moves an element to the end
+  template <class... Args>
+  reference emplace_back(
+      Args &&...args);  // Constructs an element in-place at the end
+  void pop_back();      // Removes the last element
+  void swap(SmallVector &other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // Swaps the contents
+
+  // Bonus
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos,
+                       Args &&...args);  // Inserts new elements into the
+                                         // container directly before pos
+  template <class... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+  bool is_inline() const noexcept;  // Checks whether the elements are held in
+                                    // the inline buffer
+
+ private:
+  T *inline_data() noexcept;  // Start of the inline buffer
+  size_type grown_capacity(
+      size_type min) const;  // Next geometric capacity that holds min elements
+  void reallocate(size_type capacity);  // Relocates elements into the inline
+                                        // buffer or a new heap array
+  void release() noexcept;  // Destroys the elements and frees heap storage
+  void take(SmallVector &v);  // Takes over the elements of v, leaving it
+                              // empty and inline
+
+  // attributes
+  Allocator alloc_;
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+// Member functions
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector()
+    : SmallVector(Allocator()) {}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector(const Allocator &alloc)
+    : alloc_(alloc), data_(inline_data()), size_(0), capacity_(N) {}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector(size_type n)
+    : SmallVector() {
+  reserve(n);
+  for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector(
+    std::initializer_list<value_type> const &items)
+    : SmallVector() {
+  reserve(items.size());
+  for (const auto &item : items) push_back(item);
+}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector(const SmallVector &v)
+    : SmallVector(
+          alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  for (auto it = v.cbegin(); it != v.cend(); ++it) push_back(*it);
+}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::SmallVector(SmallVector &&v) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value)
+    : SmallVector(v.alloc_) {
+  take(v);
+}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator>::~SmallVector() {
+  release();
+}
+
+template <class value_type, size_t N, class Allocator>
+SmallVector<value_type, N, Allocator> &
+SmallVector<value_type, N, Allocator>::operator=(SmallVector &&v) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value) {
+  if (this != &v) {
+    release();
+    data_ = inline_data();
+    capacity_ = N;
+    alloc_ = v.alloc_;
+    take(v);
+  }
+  return *this;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::allocator_type
+SmallVector<value_type, N, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+// Element access
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::reference
+SmallVector<value_type, N, Allocator>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_reference
+SmallVector<value_type, N, Allocator>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::reference
+SmallVector<value_type, N, Allocator>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_reference
+SmallVector<value_type, N, Allocator>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_reference
+SmallVector<value_type, N, Allocator>::front() const {
+  return data_[0];
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_reference
+SmallVector<value_type, N, Allocator>::back() const {
+  return data_[size_ - 1];
+}
+
+template <class value_type, size_t N, class Allocator>
+value_type *SmallVector<value_type, N, Allocator>::data() noexcept {
+  return data_;
+}
+
+template <class value_type, size_t N, class Allocator>
+const value_type *SmallVector<value_type, N, Allocator>::data()
+    const noexcept {
+  return data_;
+}
+
+// Iterators
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::begin() noexcept {
+  return data_;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::end() noexcept {
+  return data_ + size_;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_iterator
+SmallVector<value_type, N, Allocator>::cbegin() const noexcept {
+  return data_;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::const_iterator
+SmallVector<value_type, N, Allocator>::cend() const noexcept {
+  return data_ + size_;
+}
+
+// Capacity
+
+template <class value_type, size_t N, class Allocator>
+bool SmallVector<value_type, N, Allocator>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::size_type
+SmallVector<value_type, N, Allocator>::size() const noexcept {
+  return size_;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::size_type
+SmallVector<value_type, N, Allocator>::max_size() const noexcept {
+  return alloc_traits::max_size(alloc_);
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::reserve(size_type size) {
+  if (size > max_size()) throw std::length_error("Size exceeds max_size");
+  if (size > capacity_) reallocate(size);
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::size_type
+SmallVector<value_type, N, Allocator>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::shrink_to_fit() {
+  if (capacity_ > size_ && capacity_ > N) reallocate(size_);
+}
+
+// Modifiers
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
+    }
+  }
+  size_ = 0;
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::insert(iterator pos,
+                                              const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::insert(iterator pos,
+                                              value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <class value_type, size_t N, class Allocator>
+template <class... Args>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::emplace(const_iterator pos,
+                                               Args &&...args) {
+  size_type index = pos - data_;
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return data_ + index;
+  }
+  value_type temp(std::forward<Args>(args)...);
+  if (size_ == capacity_) reallocate(grown_capacity(size_ + 1));
+  internal::insert_shifting(alloc_, data_, size_, index, std::move(temp));
+  ++size_;
+  return data_ + index;
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::erase(iterator pos) {
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// As in Vector, the new element is constructed before the old ones are
+// relocated, so an argument that refers into the container stays valid
+// across the spill to the heap.
+template <class value_type, size_t N, class Allocator>
+template <class... Args>
+typename SmallVector<value_type, N, Allocator>::reference
+SmallVector<value_type, N, Allocator>::emplace_back(Args &&...args) {
+  if (size_ < capacity_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+  } else {
+    size_type capacity = grown_capacity(size_ + 1);
+    value_type *buffer = internal::grow_into(
+        alloc_, data_, size_, capacity, [&](value_type *&out) {
+          alloc_traits::construct(alloc_, out, std::forward<Args>(args)...);
+          ++out;
+        });
+    if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+    data_ = buffer;
+    capacity_ = capacity;
+  }
+  return data_[size_++];
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::pop_back() {
+  if (size_ > 0) alloc_traits::destroy(alloc_, data_ + --size_);
+}
+
+// Inline elements cannot change owners by swapping pointers, so the swap
+// goes through a temporary.
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::swap(SmallVector &other) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value) {
+  if (this == &other) return;
+  SmallVector temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
+
+template <class value_type, size_t N, class Allocator>
+template <class... Args>
+typename SmallVector<value_type, N, Allocator>::iterator
+SmallVector<value_type, N, Allocator>::insert_many(const_iterator pos,
+                                                   Args &&...args) {
+  return internal::insert_many(*this, pos, std::forward<Args>(args)...);
+}
+
+// As in Vector, the new elements are built in the new storage before the old
+// elements leave theirs.
+template <class value_type, size_t N, class Allocator>
+template <class... Args>
+void SmallVector<value_type, N, Allocator>::insert_many_back(Args &&...args) {
+  if (size_ + sizeof...(Args) <= capacity_) {
+    (emplace_back(std::forward<Args>(args)), ...);
+    return;
+  }
+  size_type capacity = grown_capacity(size_ + sizeof...(Args));
+  value_type *buffer = internal::grow_into(
+      alloc_, data_, size_, capacity, [&](value_type *&out) {
+        ((alloc_traits::construct(alloc_, out, std::forward<Args>(args)),
+          ++out),
+         ...);
+      });
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = buffer;
+  size_ += sizeof...(Args);
+  capacity_ = capacity;
+}
+
+template <class value_type, size_t N, class Allocator>
+bool SmallVector<value_type, N, Allocator>::is_inline() const noexcept {
+  return data_ == reinterpret_cast<const value_type *>(buffer_);
+}
+
+// Storage management
+
+template <class value_type, size_t N, class Allocator>
+value_type *SmallVector<value_type, N, Allocator>::inline_data() noexcept {
+  return reinterpret_cast<value_type *>(buffer_);
+}
+
+template <class value_type, size_t N, class Allocator>
+typename SmallVector<value_type, N, Allocator>::size_type
+SmallVector<value_type, N, Allocator>::grown_capacity(size_type min) const {
+  return internal::grown_capacity(capacity_, min, max_size());
+}
+
+// A capacity of at most N selects the inline buffer, anything larger a heap
+// array of exactly that size.
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::reallocate(size_type capacity) {
+  bool to_inline = capacity <= N;
+  if (to_inline && is_inline()) return;
+  value_type *buffer =
+      to_inline ? inline_data() : alloc_traits::allocate(alloc_, capacity);
+  try {
+    internal::relocate(data_, data_ + size_, buffer);
+  } catch (...) {
+    if (!to_inline) alloc_traits::deallocate(alloc_, buffer, capacity);
+    throw;
+  }
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = buffer;
+  capacity_ = to_inline ? N : capacity;
+}
+
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::release() noexcept {
+  clear();
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+}
+
+// Expects *this to be empty and inline. A heap array is adopted as is;
+// inline elements are relocated one by one.
+template <class value_type, size_t N, class Allocator>
+void SmallVector<value_type, N, Allocator>::take(SmallVector &v) {
+  if (v.is_inline()) {
+    internal::relocate(v.data_, v.data_ + v.size_, data_);
+  } else {
+    data_ = v.data_;
+    capacity_ = v.capacity_;
+    v.data_ = v.inline_data();
+    v.capacity_ = N;
+  }
+  size_ = v.size_;
+  v.size_ = 0;
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_SMALL_VECTOR_H_
@@ -0,0 +1,264 @@
+#ifndef SRC_MY_SPSC_QUEUE_H_
+#define SRC_MY_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "my_cache_line.h"
+
+namespace mynamespace {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Elements live in a power-of-two ring; the producer owns tail_, the
+// consumer owns head_, and each side publishes its index with a release store
+// that the other side reads with an acquire load. Each side also caches the
+// last index it saw from the other one, so the shared line is only touched
+// when the ring looks full (producer) or empty (consumer).
+//
+// push/emplace/try_* and push_n may only be called from the producer thread;
+// front/pop/try_pop and pop_n only from the consumer thread. size and empty
+// may be called from either and are exact only when the queue is quiescent.
+template <class T>
+class SpscQueue {
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+
+  // Member functions
+  explicit SpscQueue(size_type capacity);  // Parameterized constructor
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+  ~SpscQueue();  // Destructor
+
+  // Element access
+  const_reference front() const;  // Access the first element (consumer)
+
+  // Capacity
+  bool empty() const noexcept;          // Checks whether the queue is empty
+  size_type size() const noexcept;      // Returns the number of elements
+  size_type capacity() const noexcept;  // Returns the maximum number of
+                                        // elements
+
+  // Producer
+  void push(const_reference value);  // Inserts element, waits for room
+  void push(value_type &&value);     // Moves element, waits for room
+  template <class... Args>
+  void emplace(Args &&...args);  // Constructs element, waits for room
+  bool try_push(const_reference value);  // Inserts element unless full
+  bool try_push(value_type &&value);     // Moves element unless full
+  template <class... Args>
+  bool try_emplace(Args &&...args);  // Constructs element unless full
+  template <class InputIt>
+  size_type push_n(InputIt first,
+                   size_type n);  // Copies up to n elements, returns count
+
+  // Consumer
+  void pop();                       // Removes the first element, if any
+  bool try_pop(value_type &value);  // Moves out the first element unless
+                                    // empty
+  template <class OutputIt>
+  size_type pop_n(OutputIt out,
+                  size_type n);  // Moves out up to n elements, returns count
+
+ private:
+  size_type free_slots(size_type tail,
+                       size_type wanted);  // Room seen by the producer
+  size_type used_slots(size_type head,
+                       size_type wanted);  // Elements seen by the consumer
+  value_type *slot(size_type pos) const;  // Storage for a position
+
+  // attributes
+  size_type capacity_;
+  size_type mask_;
+  value_type *slots_;
+  alignas(kCacheLineSize) std::atomic<size_type> head_;  // Consumer index
+  size_type cached_tail_;  // Consumer's copy of tail_
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;  // Producer index
+  size_type cached_head_;  // Producer's copy of head_
+};
+
+template <class value_type>
+SpscQueue<value_type>::SpscQueue(size_type capacity)
+    : capacity_(capacity),
+      mask_(1),
+      slots_(nullptr),
+      head_(0),
+      cached_tail_(0),
+      tail_(0),
+      cached_head_(0) {
+  while (mask_ < capacity_) mask_ *= 2;
+  slots_ = std::allocator<value_type>().allocate(mask_);
+  --mask_;
+}
+
+template <class value_type>
+SpscQueue<value_type>::~SpscQueue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail;
+       ++pos) {
+    slot(pos)->~value_type();
+  }
+  std::allocator<value_type>().deallocate(slots_, mask_ + 1);
+}
+
+// Element access
+
+template <class value_type>
+typename SpscQueue<value_type>::const_reference SpscQueue<value_type>::front()
+    const {
+  return *slot(head_.load(std::memory_order_relaxed));
+}
+
+// Capacity
+
+template <class value_type>
+bool SpscQueue<value_type>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class value_type>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::size()
+    const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return tail - head > capacity_ ? capacity_ : tail - head;
+}
+
+template <class value_type>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::capacity()
+    const noexcept {
+  return capacity_;
+}
+
+// Producer
+
+template <class value_type>
+void SpscQueue<value_type>::push(const_reference value) {
+  emplace(value);
+}
+
+template <class value_type>
+void SpscQueue<value_type>::push(value_type &&value) {
+  emplace(std::move(value));
+}
+
+template <class value_type>
+template <class... Args>
+void SpscQueue<value_type>::emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  while (free_slots(tail, 1) == 0) std::this_thread::yield();
+  ::new (static_cast<void *>(slot(tail)))
+      value_type(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+}
+
+template <class value_type>
+bool SpscQueue<value_type>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <class value_type>
+bool SpscQueue<value_type>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <class value_type>
+template <class... Args>
+bool SpscQueue<value_type>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_slots(tail, 1) == 0) return false;
+  ::new (static_cast<void *>(slot(tail)))
+      value_type(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <class value_type>
+template <class InputIt>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::push_n(
+    InputIt first, size_type n) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type room = free_slots(tail, n);
+  if (n > room) n = room;
+  size_type done = 0;
+  try {
+    for (; done < n; ++done, ++first) {
+      ::new (static_cast<void *>(slot(tail + done))) value_type(*first);
+    }
+  } catch (...) {
+    tail_.store(tail + done, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+// Consumer
+
+template <class value_type>
+void SpscQueue<value_type>::pop() {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (used_slots(head, 1) == 0) return;
+  slot(head)->~value_type();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <class value_type>
+bool SpscQueue<value_type>::try_pop(value_type &value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (used_slots(head, 1) == 0) return false;
+  value = std::move(*slot(head));
+  slot(head)->~value_type();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <class value_type>
+template <class OutputIt>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::pop_n(
+    OutputIt out, size_type n) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type ready = used_slots(head, n);
+  if (n > ready) n = ready;
+  for (size_type i = 0; i < n; ++i, ++out) {
+    *out = std::move(*slot(head + i));
+    slot(head + i)->~value_type();
+  }
+  head_.store(head + n, std::memory_order_release);
+  return n;
+}
+
+template <class value_type>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::free_slots(
+    size_type tail, size_type wanted) {
+  if (capacity_ - (tail - cached_head_) < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+  }
+  return capacity_ - (tail - cached_head_);
+}
+
+template <class value_type>
+typename SpscQueue<value_type>::size_type SpscQueue<value_type>::used_slots(
+    size_type head, size_type wanted) {
+  if (cached_tail_ - head < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+  }
+  return cached_tail_ - head;
+}
+
+template <class value_type>
+value_type *SpscQueue<value_type>::slot(size_type pos) const {
+  return slots_ + (pos & mask_);
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_SPSC_QUEUE_H_
@@ -1,14 +1,24 @@
 #ifndef SRC_MY_STACK_H_
 #define SRC_MY_STACK_H_
 
+#include <string>
+
+#include "my_archive.h"
 #include "my_list.h"
+#include "my_small_vector.h"
+#include "my_stats.h"
+#include "my_vector.h"
 
 namespace mynamespace {
 
-template <class T, class Container = mynamespace::List<T>>
-class Stack {
+template <class T, class Container = mynamespace::Vector<T>,
+          class Stats = DefaultStats>
+class Stack : private AdapterStats<Stats> {
+  using stats_base = AdapterStats<Stats>;
+
  public:
   // Member types
+  using container_type = Container;  // The type of the underlying container
   using value_type = typename Container::value_type;  // The type of an element
   using reference =
       typename Container::reference;  // The type of the reference to an element
@@ -19,14 +29,18 @@ class Stack {
       typename Container::size_type;  // The type of the container size
 
   // Member functions
-  Stack() : c_() {}  // Default constructor
+  Stack() : stats_base("Stack"), c_() {}  // Default constructor
 
   explicit Stack(std::initializer_list<value_type> const &items)
-      : c_(items) {}  // Initializer list constructor
+      : stats_base("Stack"), c_(items) {
+    stats_base::on_size(c_.size());
+  }  // Initializer list constructor
 
-  Stack(const Stack &s) : c_(s.c_) {}  // Copy constructor
+  Stack(const Stack &s)
+      : stats_base("Stack"), c_(s.c_) {}  // Copy constructor
 
-  Stack(Stack &&s) : c_(std::move(s.c_)) {}  // Move constructor
+  Stack(Stack &&s)
+      : stats_base("Stack"), c_(std::move(s.c_)) {}  // Move constructor
 
   ~Stack() {}  // Destructor
 
@@ -52,10 +66,30 @@ class Stack {
   // Modifiers
 
   void push(const_reference value) {
-    return c_.push_back(value);
+    c_.push_back(value);
+    pushed(1);
   }  // Inserts element at the end
 
-  void pop() { return c_.pop_back(); }  // Removes the first element
+  void push(value_type &&value) {
+    c_.push_back(std::move(value));
+    pushed(1);
+  }  // Moves element to the end
+
+  void push(reference value) {
+    c_.push_back(value);
+    pushed(1);
+  }  // Inserts element at the end; an intrusive container links value itself
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+    pushed(1);
+  }  // Constructs element in-place at the end
+
+  void pop() {
+    c_.pop_back();
+    stats_base::on_call(StatsOp::kPop);
+  }  // Removes the first element
 
   void swap(Stack &other) noexcept {
     std::swap(c_, other.c_);
@@ -63,13 +97,69 @@ class Stack {
 
   template <class... Args>
   void insert_many_front(Args &&...args) {
-    return c_.insert_many_back(args...);
+    c_.insert_many_back(std::forward<Args>(args)...);
+    pushed(sizeof...(Args));
   }  // Appends new elements to the top of the container
 
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type before = c_.size();
+    append_range(c_, first, last, 0);
+    pushed(c_.size() - before);
+  }  // Pushes [first, last) in order, in one bulk insert if the container
+     // has one
+
+  // Serialization
+
+  void save(const std::string &path) const {
+    archive::save(c_, path);
+  }  // Writes the elements to an archive at path, bottom to top
+
+  void load(const std::string &path) {
+    archive::load(c_, path);
+    stats_base::on_size(c_.size());
+  }  // Replaces the elements with those of the archive at path
+
+  container_type &container() noexcept {
+    return c_;
+  }  // The underlying container, bottom to top, for algorithms over all the
+     // elements such as those of parallel::
+
+  const container_type &container() const noexcept { return c_; }
+
+  // Instrumentation
+
+  ContainerStats stats() const noexcept {
+    ContainerStats s = stats_base::snapshot();
+    if constexpr (has_stats_v<Container>) s += c_.stats();
+    return s;
+  }  // Returns the adapter's counters merged with the container's
+
  private:
+  template <class C, class InputIt>
+  static auto append_range(C &c, InputIt first, InputIt last, int)
+      -> decltype(c.insert(c.cend(), first, last), void()) {
+    c.insert(c.cend(), first, last);
+  }  // Range insert of containers such as List
+
+  template <class C, class InputIt>
+  static void append_range(C &c, InputIt first, InputIt last, long) {
+    for (; first != last; ++first) c.push_back(*first);
+  }  // Element by element for the others
+
+  void pushed(size_type n) noexcept {
+    stats_base::on_call(StatsOp::kPush, n);
+    stats_base::on_size(c_.size());
+  }  // Records n pushes and the new size
+
   Container c_;
 };
 
+// A Stack that holds its first N elements inside the object and allocates
+// only once it grows deeper.
+template <class T, size_t N, class Stats = DefaultStats>
+using SmallStack = Stack<T, SmallVector<T, N>, Stats>;
+
 }  // namespace mynamespace
 
 #endif  // SRC_MY_STACK_H_
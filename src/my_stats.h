@@ -0,0 +1,317 @@
+#ifndef SRC_MY_STATS_H_
+#define SRC_MY_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace mynamespace {
+
+// Instrumentation policies for List, Vector, Deque, Queue and Stack. A
+// container takes the policy as its last template parameter and privately
+// inherits from it, so the default NoStats is an empty base whose hooks
+// compile to nothing.
+// CountingStats keeps per-container counters and registers itself with
+// StatsRegistry, which can dump every container alive in the process.
+//
+// Defining MY_CONTAINERS_STATS before the first include switches the default
+// policy to CountingStats. It changes the container types, so it has to be
+// set the same way for the whole program.
+
+// Operations counted per call. Insert and erase are counted per element, so
+// push_back, emplace and pop_front show up there as well.
+enum class StatsOp : size_t {
+  kInsert,
+  kErase,
+  kSort,
+  kMerge,
+  kSplice,
+  kUnique,
+  kReverse,
+  kClear,
+  kPush,
+  kPop,
+  kCount
+};
+
+inline const char *stats_op_name(StatsOp op) noexcept {
+  static const char *const kNames[] = {"insert",  "erase",   "sort",
+                                       "merge",   "splice",  "unique",
+                                       "reverse", "clear",   "push",
+                                       "pop"};
+  return kNames[static_cast<size_t>(op)];
+}
+
+// Plain snapshot of the counters of one container, or a sum over many.
+struct ContainerStats {
+  static constexpr size_t kOps = static_cast<size_t>(StatsOp::kCount);
+
+  size_t allocations = 0;      // Allocation calls
+  size_t deallocations = 0;    // Deallocation calls
+  size_t bytes_allocated = 0;  // Bytes requested from the allocator
+  size_t bytes_freed = 0;      // Bytes given back to the allocator
+  size_t bytes_in_use = 0;     // Bytes held now, following spliced nodes
+  size_t peak_bytes = 0;       // High-water mark of bytes_in_use
+  size_t peak_size = 0;        // High-water mark of the number of elements
+  size_t calls[kOps] = {};     // Per-operation counters
+
+  size_t count(StatsOp op) const noexcept {
+    return calls[static_cast<size_t>(op)];
+  }  // Returns the counter of an operation
+
+  ContainerStats &operator+=(const ContainerStats &other) noexcept {
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    bytes_allocated += other.bytes_allocated;
+    bytes_freed += other.bytes_freed;
+    bytes_in_use += other.bytes_in_use;
+    if (other.peak_bytes > peak_bytes) peak_bytes = other.peak_bytes;
+    if (other.peak_size > peak_size) peak_size = other.peak_size;
+    for (size_t i = 0; i < kOps; ++i) calls[i] += other.calls[i];
+    return *this;
+  }  // Adds counters up; peaks keep the larger value
+};
+
+// Disabled policy: every hook is an empty inline function.
+class NoStats {
+ public:
+  static constexpr bool kEnabled = false;
+
+  explicit NoStats(const char * = "") noexcept {}
+
+  void on_allocate(size_t) noexcept {}
+  void on_deallocate(size_t) noexcept {}
+  void on_call(StatsOp, size_t = 1) noexcept {}
+  void on_size(size_t) noexcept {}
+  void on_transfer(NoStats &, size_t) noexcept {}
+  ContainerStats snapshot() const noexcept { return ContainerStats(); }
+};
+
+class CountingStats;
+
+// Process-wide list of live CountingStats objects, grouped by label. Counters
+// of destroyed containers are folded into their label's totals so a dump
+// still shows them. Registration takes a mutex; counting does not.
+class StatsRegistry {
+ public:
+  static StatsRegistry &instance() {
+    static StatsRegistry registry;
+    return registry;
+  }  // Returns the registry of the process
+
+  ContainerStats total(
+      const std::string &label) const;  // Sums live and retired counters
+  size_t live(const std::string &label) const;  // Counts live containers
+  void dump(std::ostream &out) const;  // Prints one line per label
+
+ private:
+  friend class CountingStats;
+
+  struct Entry {
+    size_t live = 0;
+    ContainerStats retired;
+  };
+
+  StatsRegistry() = default;
+  void attach(const CountingStats *stats);
+  void detach(const CountingStats *stats);
+  std::map<std::string, std::pair<size_t, ContainerStats>> collect()
+      const;  // Sums everything per label, under the held mutex
+
+  mutable std::mutex mutex_;
+  std::unordered_set<const CountingStats *> live_;
+  std::map<std::string, Entry> labels_;
+};
+
+// Enabled policy. Each counter has a single writer, the thread that owns the
+// container, so it is bumped with a relaxed load and store rather than a
+// locked read-modify-write; that keeps dump() from another thread well
+// defined at the price of possibly reading slightly stale values.
+class CountingStats {
+ public:
+  static constexpr bool kEnabled = true;
+
+  explicit CountingStats(const char *label = "") : label_(label) {
+    StatsRegistry::instance().attach(this);
+  }
+  CountingStats(const CountingStats &other) : CountingStats(other.label_) {}
+  CountingStats &operator=(const CountingStats &) noexcept {
+    return *this;
+  }  // Counters belong to the object, not to its contents
+  ~CountingStats() { StatsRegistry::instance().detach(this); }
+
+  const char *label() const noexcept { return label_; }
+
+  void on_allocate(size_t bytes) noexcept {
+    bump(allocations_, 1);
+    bump(bytes_allocated_, bytes);
+    grow_bytes(bytes);
+  }
+
+  void on_deallocate(size_t bytes) noexcept {
+    bump(deallocations_, 1);
+    bump(bytes_freed_, bytes);
+    bump(bytes_in_use_, 0 - bytes);
+  }
+
+  void on_call(StatsOp op, size_t n = 1) noexcept {
+    bump(calls_[static_cast<size_t>(op)], n);
+  }
+
+  void on_size(size_t size) noexcept { raise(peak_size_, size); }
+
+  void on_transfer(CountingStats &from, size_t bytes) noexcept {
+    bump(from.bytes_in_use_, 0 - bytes);
+    grow_bytes(bytes);
+  }  // Moves ownership of bytes from another container
+
+  ContainerStats snapshot() const noexcept {
+    ContainerStats s;
+    s.allocations = allocations_.load(std::memory_order_relaxed);
+    s.deallocations = deallocations_.load(std::memory_order_relaxed);
+    s.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+    s.bytes_freed = bytes_freed_.load(std::memory_order_relaxed);
+    s.bytes_in_use = bytes_in_use_.load(std::memory_order_relaxed);
+    s.peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    s.peak_size = peak_size_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < ContainerStats::kOps; ++i) {
+      s.calls[i] = calls_[i].load(std::memory_order_relaxed);
+    }
+    return s;
+  }
+
+ private:
+  using counter = std::atomic<size_t>;
+
+  static void bump(counter &c, size_t n) noexcept {
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  static void raise(counter &c, size_t value) noexcept {
+    if (value > c.load(std::memory_order_relaxed)) {
+      c.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  void grow_bytes(size_t bytes) noexcept {
+    bump(bytes_in_use_, bytes);
+    raise(peak_bytes_, bytes_in_use_.load(std::memory_order_relaxed));
+  }
+
+  const char *label_;
+  counter allocations_{0};
+  counter deallocations_{0};
+  counter bytes_allocated_{0};
+  counter bytes_freed_{0};
+  counter bytes_in_use_{0};
+  counter peak_bytes_{0};
+  counter peak_size_{0};
+  counter calls_[ContainerStats::kOps] = {};
+};
+
+// Base through which the adapters hold their policy. Disabled, it is an
+// empty class of its own rather than NoStats, so it still takes no room when
+// the adapted container derives from NoStats too.
+template <class Stats, bool = Stats::kEnabled>
+class AdapterStats : public Stats {
+ public:
+  using Stats::Stats;
+};
+
+template <class Stats>
+class AdapterStats<Stats, false> {
+ public:
+  explicit AdapterStats(const char * = "") noexcept {}
+
+  void on_call(StatsOp, size_t = 1) noexcept {}
+  void on_size(size_t) noexcept {}
+  ContainerStats snapshot() const noexcept { return ContainerStats(); }
+};
+
+#ifdef MY_CONTAINERS_STATS
+using DefaultStats = CountingStats;
+#else
+using DefaultStats = NoStats;
+#endif
+
+// Whether a container exposes stats(), which adapters fold into their own.
+template <class Container, class = void>
+struct has_stats : std::false_type {};
+
+template <class Container>
+struct has_stats<
+    Container, std::void_t<decltype(std::declval<const Container &>().stats())>>
+    : std::true_type {};
+
+template <class Container>
+inline constexpr bool has_stats_v = has_stats<Container>::value;
+
+// StatsRegistry
+
+inline void StatsRegistry::attach(const CountingStats *stats) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  live_.insert(stats);
+  ++labels_[stats->label()].live;
+}
+
+inline void StatsRegistry::detach(const CountingStats *stats) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  live_.erase(stats);
+  Entry &entry = labels_[stats->label()];
+  --entry.live;
+  entry.retired += stats->snapshot();
+}
+
+inline std::map<std::string, std::pair<size_t, ContainerStats>>
+StatsRegistry::collect() const {
+  std::map<std::string, std::pair<size_t, ContainerStats>> sums;
+  for (const auto &[label, entry] : labels_) {
+    sums[label] = {entry.live, entry.retired};
+  }
+  for (const CountingStats *stats : live_) {
+    sums[stats->label()].second += stats->snapshot();
+  }
+  return sums;
+}
+
+inline ContainerStats StatsRegistry::total(const std::string &label) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto sums = collect();
+  auto it = sums.find(label);
+  return it == sums.end() ? ContainerStats() : it->second.second;
+}
+
+inline size_t StatsRegistry::live(const std::string &label) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = labels_.find(label);
+  return it == labels_.end() ? 0 : it->second.live;
+}
+
+inline void StatsRegistry::dump(std::ostream &out) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &[label, sum] : collect()) {
+    const ContainerStats &s = sum.second;
+    out << label << ": live " << sum.first << ", allocations "
+        << s.allocations << ", deallocations " << s.deallocations
+        << ", bytes allocated " << s.bytes_allocated << ", bytes freed "
+        << s.bytes_freed << ", bytes in use " << s.bytes_in_use
+        << ", peak bytes " << s.peak_bytes << ", peak size " << s.peak_size;
+    for (size_t i = 0; i < ContainerStats::kOps; ++i) {
+      if (s.calls[i] > 0) {
+        out << ", " << stats_op_name(static_cast<StatsOp>(i)) << ' '
+            << s.calls[i];
+      }
+    }
+    out << '\n';
+  }
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_STATS_H_
@@ -0,0 +1,74 @@
+#ifndef SRC_MY_THREAD_POOL_H_
+#define SRC_MY_THREAD_POOL_H_
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "my_blocking_queue.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Fixed set of worker threads taking tasks from one BlockingQueue. A thread
+// that waits for its own tasks should keep calling run_one, so tasks that
+// start more tasks cannot stall the pool with every worker waiting. The
+// destructor lets the workers finish the queued tasks, then joins them.
+class ThreadPool {
+ public:
+  // Member types
+  using size_type = size_t;                   // The type of the worker count
+  using task_type = std::function<void()>;    // The type of a task
+
+  // Member functions
+  explicit ThreadPool(size_type workers) {
+    workers_.reserve(workers);
+    for (size_type i = 0; i < workers; ++i) {
+      workers_.emplace_back([this] {
+        task_type task;
+        while (tasks_.pop_wait(task)) task();
+      });
+    }
+  }  // Starts the worker threads
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool() {
+    tasks_.close();
+    for (std::thread &worker : workers_) worker.join();
+  }  // Destructor
+
+  static ThreadPool &shared() {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1
+                               ? std::thread::hardware_concurrency() - 1
+                               : 0);
+    return pool;
+  }  // Process-wide pool with a worker per hardware thread but the caller's
+
+  // Capacity
+
+  size_type size() const noexcept {
+    return workers_.size();
+  }  // Returns the number of workers
+
+  // Tasks
+
+  void submit(task_type task) {
+    tasks_.push(std::move(task));
+  }  // Queues a task for the next free worker
+
+  bool run_one() {
+    task_type task;
+    if (!tasks_.try_pop(task)) return false;
+    task();
+    return true;
+  }  // Runs a queued task on the calling thread; false if there was none
+
+ private:
+  BlockingQueue<task_type> tasks_;
+  Vector<std::thread> workers_;
+};
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_THREAD_POOL_H_
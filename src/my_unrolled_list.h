@@ -0,0 +1,725 @@
+#ifndef SRC_MY_UNROLLED_LIST_H_
+#define SRC_MY_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mynamespace {
+
+// Default number of elements per chunk: about four cache lines of payload.
+template <class T>
+constexpr size_t unrolled_chunk_size() {
+  return sizeof(T) * 4 > 256 ? 4 : 256 / sizeof(T);
+}
+
+// Doubly linked list of chunks, each storing up to N elements inline in the
+// range [begin_, end_). Insertion and erasure near an iterator shift at most
+// N elements, and may invalidate iterators into the affected chunk. A chunk
+// that erasure leaves less than half full is merged into a neighbour, which
+// also invalidates iterators into that neighbour.
+template <class T, size_t N = unrolled_chunk_size<T>()>
+class UnrolledList {
+  static_assert(N > 1, "A chunk must hold at least two elements");
+
+  class ChunkBase {
+   public:
+    ChunkBase *prev_;
+    ChunkBase *next_;
+    size_t begin_;
+    size_t end_;
+
+    ChunkBase(ChunkBase *prev = nullptr, ChunkBase *next = nullptr,
+              size_t begin = 0)
+        : prev_(prev), next_(next), begin_(begin), end_(begin) {}
+  };
+
+  class Chunk : public ChunkBase {
+   public:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+
+    explicit Chunk(size_t begin) : ChunkBase(nullptr, nullptr, begin) {}
+  };
+
+  template <class value_type>
+  class UnrolledListIterator {
+   public:
+    ChunkBase *chunk_;
+    size_t index_;
+
+    UnrolledListIterator(ChunkBase *chunk, size_t index)
+        : chunk_(chunk), index_(index){};
+
+    const value_type &operator*() const {
+      return *UnrolledList::slot(chunk_, index_);
+    };
+
+    UnrolledListIterator &operator++() {
+      if (++index_ == chunk_->end_) {
+        chunk_ = chunk_->next_;
+        index_ = chunk_->begin_;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator &operator--() {
+      if (index_ == chunk_->begin_) {
+        chunk_ = chunk_->prev_;
+        index_ = chunk_->end_;
+      }
+      --index_;
+      return *this;
+    }
+
+    bool operator==(const UnrolledListIterator &it) const {
+      return chunk_ == it.chunk_ && index_ == it.index_;
+    };
+
+    bool operator!=(const UnrolledListIterator &it) const {
+      return !(*this == it);
+    }
+  };
+
+  template <class value_type>
+  class UnrolledListConstIterator : public UnrolledListIterator<value_type> {
+   public:
+    UnrolledListConstIterator(ChunkBase *chunk, size_t index)
+        : UnrolledListIterator<value_type>(chunk, index){};
+
+    UnrolledListConstIterator(const UnrolledListIterator<value_type> &it)
+        : UnrolledListIterator<value_type>(it) {}
+
+    const value_type &operator*() const {
+      return *UnrolledList::slot(this->chunk_, this->index_);
+    }
+  };
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using iterator =
+      UnrolledListIterator<value_type>;  // The type for iterating through the
+                                         // container
+  using const_iterator =
+      UnrolledListConstIterator<value_type>;  // The constant type for
+                                              // iterating through the
+                                              // container
+
+  static constexpr size_type chunk_size = N;  // Elements stored per chunk
+
+  // Member functions
+  UnrolledList();                      // Default constructor
+  explicit UnrolledList(size_type n);  // Parameterized constructor
+  UnrolledList(std::initializer_list<value_type> const
+                   &items);             // Initializer list constructor
+  UnrolledList(const UnrolledList &l);  // Copy constructor
+  UnrolledList(UnrolledList &&l);       // Move constructor
+  ~UnrolledList();                      // Destructor
+  UnrolledList &operator=(UnrolledList &&l) noexcept;  // Assignment operator
+                                                       // overload for moving
+                                                       // object
+
+  // Element access
+  const_reference front() const;  // Access the first element
+  const_reference back() const;   // Access the last element
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the beginning
+  iterator end() noexcept;    // Returns an iterator to the end
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+
+  // Modifiers
+  void clear() noexcept;  // Clears the contents
+  iterator insert(
+      iterator pos,
+      const_reference value);  // Inserts element into concrete pos and returns
+                               // the iterator that points to the new element
+  iterator insert(iterator pos,
+                  value_type &&value);  // Moves element into concrete pos
+  template <class... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // Constructs element in-place before pos
+  iterator erase(iterator pos);  // Erases element at pos and returns the
+                                 // iterator that follows it
+  void push_back(const_reference value);  // Adds an element to the end
+  void push_back(value_type &&value);     // Moves an element to the end
+  template <class... Args>
+  reference emplace_back(
+      Args &&...args);  // Constructs an element in-place at the end
+  void pop_back();      // Removes the last element
+  void push_front(const_reference value);  // Adds an element to the head
+  void push_front(value_type &&value);     // Moves an element to the head
+  template <class... Args>
+  reference emplace_front(
+      Args &&...args);  // Constructs an element in-place at the head
+  void pop_front();     // Removes the first element
+  void swap(UnrolledList &other) noexcept;  // Swaps the contents
+  void merge(UnrolledList &other);          // Merges two sorted lists
+  template <class Compare>
+  void merge(UnrolledList &other,
+             Compare comp);  // Merges two lists sorted with respect to comp
+  void splice(const_iterator pos,
+              UnrolledList &other);  // Transfers elements from list other
+                                     // starting from pos
+  void reverse() noexcept;           // Reverses the order of the elements
+  void unique();                     // Removes consecutive duplicate elements
+  void sort();                       // Sorts the elements
+  template <class Compare>
+  void sort(Compare comp);  // Sorts the elements using comp
+
+  // Bonus
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos,
+                       Args &&...args);  // Inserts new elements into the
+                                         // container directly before pos
+  template <class... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+  template <class... Args>
+  void insert_many_front(
+      Args &&...args);  // Appends new elements to the top of the container
+
+ private:
+  static value_type *slot(const ChunkBase *chunk,
+                          size_type index) noexcept;  // Element storage
+  Chunk *create_chunk(ChunkBase *pos,
+                      size_type begin);  // Links a new empty chunk before pos
+  void destroy_chunk(ChunkBase *chunk) noexcept;  // Unlinks and frees a chunk
+  ChunkBase *split(ChunkBase *chunk,
+                   size_type index);  // Moves [index, end_) to a new chunk
+  size_type absorb(ChunkBase *dest,
+                   ChunkBase *src);  // Appends src to dest and frees src
+  iterator normalize(ChunkBase *chunk,
+                     size_type index) noexcept;  // Steps past a chunk's end
+  void take_chunks(UnrolledList &other) noexcept;  // Steals the chunks of other
+
+  // attributes
+  size_type size_;
+  ChunkBase fake_chunk_;
+};
+
+// Member functions
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::UnrolledList()
+    : size_(0), fake_chunk_(&fake_chunk_, &fake_chunk_) {}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::UnrolledList(size_type n) : UnrolledList() {
+  for (size_type i = 0; i < n; ++i) {
+    emplace_back();
+  }
+}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::UnrolledList(
+    std::initializer_list<value_type> const &items)
+    : UnrolledList() {
+  for (const auto &item : items) {
+    push_back(item);
+  }
+}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::UnrolledList(const UnrolledList &l)
+    : UnrolledList() {
+  for (auto it = l.cbegin(); it != l.cend(); ++it) {
+    push_back(*it);
+  }
+}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::UnrolledList(UnrolledList &&l) : UnrolledList() {
+  take_chunks(l);
+}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N>::~UnrolledList() {
+  clear();
+}
+
+template <class value_type, size_t N>
+UnrolledList<value_type, N> &UnrolledList<value_type, N>::operator=(
+    UnrolledList &&l) noexcept {
+  swap(l);
+  return *this;
+}
+
+// Element access
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::const_reference
+UnrolledList<value_type, N>::front() const {
+  return *slot(fake_chunk_.next_, fake_chunk_.next_->begin_);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::const_reference
+UnrolledList<value_type, N>::back() const {
+  return *slot(fake_chunk_.prev_, fake_chunk_.prev_->end_ - 1);
+}
+
+// Iterators
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::begin() noexcept {
+  return iterator(fake_chunk_.next_, fake_chunk_.next_->begin_);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::end() noexcept {
+  return iterator(&fake_chunk_, 0);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::const_iterator
+UnrolledList<value_type, N>::cbegin() const noexcept {
+  return const_iterator(fake_chunk_.next_, fake_chunk_.next_->begin_);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::const_iterator
+UnrolledList<value_type, N>::cend() const noexcept {
+  return const_iterator(const_cast<ChunkBase *>(&fake_chunk_), 0);
+}
+
+// Capacity
+
+template <class value_type, size_t N>
+bool UnrolledList<value_type, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::size_type
+UnrolledList<value_type, N>::size() const noexcept {
+  return size_;
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::size_type
+UnrolledList<value_type, N>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / sizeof(Chunk) * N;
+}
+
+// Modifiers
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::clear() noexcept {
+  while (fake_chunk_.next_ != &fake_chunk_) {
+    ChunkBase *chunk = fake_chunk_.next_;
+    for (size_type i = chunk->begin_; i < chunk->end_; ++i) {
+      slot(chunk, i)->~value_type();
+    }
+    destroy_chunk(chunk);
+  }
+  size_ = 0;
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// Inserting at a chunk boundary constructs straight into free space of one
+// of the neighbouring chunks, or into a fresh chunk. Inserting inside a
+// chunk shifts the shorter side, splitting the chunk first if it is full.
+template <class value_type, size_t N>
+template <class... Args>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::emplace(const_iterator pos, Args &&...args) {
+  ChunkBase *chunk = pos.chunk_;
+  size_type i = pos.index_;
+  if (chunk == &fake_chunk_ || i == chunk->begin_) {
+    ChunkBase *prev = chunk->prev_;
+    if (prev != &fake_chunk_ && prev->end_ < N) {
+      new (slot(prev, prev->end_)) value_type(std::forward<Args>(args)...);
+      ++size_;
+      return iterator(prev, prev->end_++);
+    }
+    if (chunk != &fake_chunk_ && chunk->begin_ > 0) {
+      new (slot(chunk, chunk->begin_ - 1))
+          value_type(std::forward<Args>(args)...);
+      ++size_;
+      return iterator(chunk, --chunk->begin_);
+    }
+    size_type at = (chunk != &fake_chunk_ && prev == &fake_chunk_) ? N - 1 : 0;
+    Chunk *fresh = create_chunk(chunk, at);
+    try {
+      new (slot(fresh, at)) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      destroy_chunk(fresh);
+      throw;
+    }
+    fresh->end_ = at + 1;
+    ++size_;
+    return iterator(fresh, at);
+  }
+  value_type temp(std::forward<Args>(args)...);
+  bool front_shorter = i - chunk->begin_ < chunk->end_ - i;
+  if (chunk->begin_ == 0 && chunk->end_ == N) split(chunk, i);
+  if (chunk->end_ == i) {
+    new (slot(chunk, i)) value_type(std::move(temp));
+    ++chunk->end_;
+  } else if (chunk->begin_ == 0 || (!front_shorter && chunk->end_ < N)) {
+    new (slot(chunk, chunk->end_))
+        value_type(std::move(*slot(chunk, chunk->end_ - 1)));
+    ++chunk->end_;
+    std::move_backward(slot(chunk, i), slot(chunk, chunk->end_ - 2),
+                       slot(chunk, chunk->end_ - 1));
+    *slot(chunk, i) = std::move(temp);
+  } else {
+    new (slot(chunk, chunk->begin_ - 1))
+        value_type(std::move(*slot(chunk, chunk->begin_)));
+    --chunk->begin_;
+    --i;
+    std::move(slot(chunk, chunk->begin_ + 2), slot(chunk, i + 1),
+              slot(chunk, chunk->begin_ + 1));
+    *slot(chunk, i) = std::move(temp);
+  }
+  ++size_;
+  return iterator(chunk, i);
+}
+
+// Erasing shifts the shorter side of the chunk. A chunk left under half full
+// is merged with whichever neighbour has room for its elements.
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::erase(iterator pos) {
+  ChunkBase *chunk = pos.chunk_;
+  size_type i = pos.index_;
+  --size_;
+  if (i - chunk->begin_ < chunk->end_ - 1 - i) {
+    std::move_backward(slot(chunk, chunk->begin_), slot(chunk, i),
+                       slot(chunk, i + 1));
+    slot(chunk, chunk->begin_++)->~value_type();
+    ++i;
+  } else {
+    std::move(slot(chunk, i + 1), slot(chunk, chunk->end_), slot(chunk, i));
+    slot(chunk, --chunk->end_)->~value_type();
+  }
+  if (chunk->begin_ == chunk->end_) {
+    ChunkBase *next = chunk->next_;
+    destroy_chunk(chunk);
+    return iterator(next, next->begin_);
+  }
+  size_type fill = chunk->end_ - chunk->begin_;
+  if (fill < N / 2) {
+    size_type offset = i - chunk->begin_;
+    ChunkBase *next = chunk->next_;
+    ChunkBase *prev = chunk->prev_;
+    if (next != &fake_chunk_ && fill + next->end_ - next->begin_ <= N) {
+      absorb(chunk, next);
+      return normalize(chunk, chunk->begin_ + offset);
+    }
+    if (prev != &fake_chunk_ && fill + prev->end_ - prev->begin_ <= N) {
+      return normalize(prev, absorb(prev, chunk) + offset);
+    }
+  }
+  return normalize(chunk, i);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::push_back(const_reference value) {
+  emplace(cend(), value);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::push_back(value_type &&value) {
+  emplace(cend(), std::move(value));
+}
+
+template <class value_type, size_t N>
+template <class... Args>
+typename UnrolledList<value_type, N>::reference
+UnrolledList<value_type, N>::emplace_back(Args &&...args) {
+  iterator it = emplace(cend(), std::forward<Args>(args)...);
+  return *slot(it.chunk_, it.index_);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::pop_back() {
+  if (size_ > 0) {
+    ChunkBase *chunk = fake_chunk_.prev_;
+    slot(chunk, --chunk->end_)->~value_type();
+    if (chunk->begin_ == chunk->end_) destroy_chunk(chunk);
+    --size_;
+  }
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::push_front(const_reference value) {
+  emplace(cbegin(), value);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::push_front(value_type &&value) {
+  emplace(cbegin(), std::move(value));
+}
+
+template <class value_type, size_t N>
+template <class... Args>
+typename UnrolledList<value_type, N>::reference
+UnrolledList<value_type, N>::emplace_front(Args &&...args) {
+  iterator it = emplace(cbegin(), std::forward<Args>(args)...);
+  return *slot(it.chunk_, it.index_);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::pop_front() {
+  if (size_ > 0) {
+    ChunkBase *chunk = fake_chunk_.next_;
+    slot(chunk, chunk->begin_++)->~value_type();
+    if (chunk->begin_ == chunk->end_) destroy_chunk(chunk);
+    --size_;
+  }
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::swap(UnrolledList &other) noexcept {
+  UnrolledList temp;
+  temp.take_chunks(*this);
+  take_chunks(other);
+  other.take_chunks(temp);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::merge(UnrolledList &other) {
+  merge(other, std::less<value_type>());
+}
+
+template <class value_type, size_t N>
+template <class Compare>
+void UnrolledList<value_type, N>::merge(UnrolledList &other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  UnrolledList result;
+  iterator a = begin();
+  iterator b = other.begin();
+  while (a != end() && b != other.end()) {
+    if (comp(*b, *a)) {
+      result.emplace_back(std::move(*slot(b.chunk_, b.index_)));
+      ++b;
+    } else {
+      result.emplace_back(std::move(*slot(a.chunk_, a.index_)));
+      ++a;
+    }
+  }
+  for (; a != end(); ++a) {
+    result.emplace_back(std::move(*slot(a.chunk_, a.index_)));
+  }
+  for (; b != other.end(); ++b) {
+    result.emplace_back(std::move(*slot(b.chunk_, b.index_)));
+  }
+  other.clear();
+  swap(result);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::splice(const_iterator pos,
+                                         UnrolledList &other) {
+  if (this == &other || other.empty()) return;
+  ChunkBase *chunk = pos.chunk_;
+  if (chunk != &fake_chunk_ && pos.index_ != chunk->begin_) {
+    chunk = split(chunk, pos.index_);
+  }
+  ChunkBase *first = other.fake_chunk_.next_;
+  ChunkBase *last = other.fake_chunk_.prev_;
+  first->prev_ = chunk->prev_;
+  last->next_ = chunk;
+  chunk->prev_->next_ = first;
+  chunk->prev_ = last;
+  size_ += other.size_;
+  other.fake_chunk_.next_ = other.fake_chunk_.prev_ = &other.fake_chunk_;
+  other.size_ = 0;
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::reverse() noexcept {
+  if (size_ < 2) return;
+  iterator it1 = begin();
+  iterator it2 = end();
+  --it2;
+  for (size_type mid = 0; mid < size_ / 2; ++it1, --it2, ++mid) {
+    std::swap(*slot(it1.chunk_, it1.index_), *slot(it2.chunk_, it2.index_));
+  }
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::unique() {
+  if (size_ < 2) return;
+  iterator kept = begin();
+  iterator it = kept;
+  size_type count = 1;
+  for (++it; it != end(); ++it) {
+    if (!(*it == *kept)) {
+      ++kept;
+      if (kept != it) {
+        *slot(kept.chunk_, kept.index_) =
+            std::move(*slot(it.chunk_, it.index_));
+      }
+      ++count;
+    }
+  }
+  while (size_ > count) pop_back();
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::sort() {
+  sort(std::less<value_type>());
+}
+
+template <class value_type, size_t N>
+template <class Compare>
+void UnrolledList<value_type, N>::sort(Compare comp) {
+  if (size_ < 2) return;
+  std::vector<value_type> buffer;
+  buffer.reserve(size_);
+  for (iterator it = begin(); it != end(); ++it) {
+    buffer.push_back(std::move(*slot(it.chunk_, it.index_)));
+  }
+  std::stable_sort(buffer.begin(), buffer.end(), comp);
+  auto from = buffer.begin();
+  for (iterator it = begin(); it != end(); ++it, ++from) {
+    *slot(it.chunk_, it.index_) = std::move(*from);
+  }
+}
+
+template <class value_type, size_t N>
+template <class... Args>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::insert_many(const_iterator pos, Args &&...args) {
+  iterator it(pos);
+  ((it = emplace(it, std::forward<Args>(args)), ++it), ...);
+  return it;
+}
+
+template <class value_type, size_t N>
+template <class... Args>
+void UnrolledList<value_type, N>::insert_many_back(Args &&...args) {
+  insert_many(cend(), std::forward<Args>(args)...);
+}
+
+template <class value_type, size_t N>
+template <class... Args>
+void UnrolledList<value_type, N>::insert_many_front(Args &&...args) {
+  insert_many(cbegin(), std::forward<Args>(args)...);
+}
+
+// Chunk management
+
+template <class value_type, size_t N>
+value_type *UnrolledList<value_type, N>::slot(const ChunkBase *chunk,
+                                              size_type index) noexcept {
+  const Chunk *c = static_cast<const Chunk *>(chunk);
+  return reinterpret_cast<value_type *>(
+             const_cast<unsigned char *>(c->storage_)) +
+         index;
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::Chunk *
+UnrolledList<value_type, N>::create_chunk(ChunkBase *pos, size_type begin) {
+  Chunk *chunk = new Chunk(begin);
+  chunk->prev_ = pos->prev_;
+  chunk->next_ = pos;
+  pos->prev_->next_ = chunk;
+  pos->prev_ = chunk;
+  return chunk;
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::destroy_chunk(ChunkBase *chunk) noexcept {
+  chunk->prev_->next_ = chunk->next_;
+  chunk->next_->prev_ = chunk->prev_;
+  delete static_cast<Chunk *>(chunk);
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::ChunkBase *
+UnrolledList<value_type, N>::split(ChunkBase *chunk, size_type index) {
+  Chunk *tail = create_chunk(chunk->next_, 0);
+  for (size_type i = index; i < chunk->end_; ++i) {
+    new (slot(tail, tail->end_)) value_type(std::move(*slot(chunk, i)));
+    ++tail->end_;
+    slot(chunk, i)->~value_type();
+  }
+  chunk->end_ = index;
+  return tail;
+}
+
+// dest is compacted to the front of its storage first if the elements of src
+// would not fit after its end. Returns the index in dest of src's first
+// element.
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::size_type
+UnrolledList<value_type, N>::absorb(ChunkBase *dest, ChunkBase *src) {
+  if (dest->end_ + (src->end_ - src->begin_) > N) {
+    size_type shift = dest->begin_;
+    for (size_type i = dest->begin_; i < dest->end_; ++i) {
+      new (slot(dest, i - shift)) value_type(std::move(*slot(dest, i)));
+      slot(dest, i)->~value_type();
+    }
+    dest->begin_ = 0;
+    dest->end_ -= shift;
+  }
+  size_type at = dest->end_;
+  for (size_type i = src->begin_; i < src->end_; ++i) {
+    new (slot(dest, dest->end_)) value_type(std::move(*slot(src, i)));
+    ++dest->end_;
+    slot(src, i)->~value_type();
+  }
+  destroy_chunk(src);
+  return at;
+}
+
+template <class value_type, size_t N>
+typename UnrolledList<value_type, N>::iterator
+UnrolledList<value_type, N>::normalize(ChunkBase *chunk,
+                                       size_type index) noexcept {
+  if (index == chunk->end_) {
+    chunk = chunk->next_;
+    index = chunk->begin_;
+  }
+  return iterator(chunk, index);
+}
+
+template <class value_type, size_t N>
+void UnrolledList<value_type, N>::take_chunks(UnrolledList &other) noexcept {
+  if (other.size_ > 0) {
+    fake_chunk_.next_ = other.fake_chunk_.next_;
+    fake_chunk_.prev_ = other.fake_chunk_.prev_;
+    fake_chunk_.next_->prev_ = &fake_chunk_;
+    fake_chunk_.prev_->next_ = &fake_chunk_;
+    size_ = other.size_;
+    other.fake_chunk_.next_ = other.fake_chunk_.prev_ = &other.fake_chunk_;
+    other.size_ = 0;
+  }
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_UNROLLED_LIST_H_
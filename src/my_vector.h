@@ -0,0 +1,476 @@
+#ifndef SRC_MY_VECTOR_H_
+#define SRC_MY_VECTOR_H_
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "my_stats.h"
+#include "my_vector_storage.h"
+
+namespace mynamespace {
+
+template <class T, class Allocator = std::allocator<T>,
+          class Stats = DefaultStats>
+class Vector : private Stats {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  // Member types
+  using value_type = T;   // The type of an element
+  using reference = T &;  // The type of the reference to an element
+  using const_reference =
+      const T &;             // The type of the constant reference to an element
+  using size_type = size_t;  // The type of the container size
+  using allocator_type = Allocator;  // The type of the element allocator
+  using iterator = T *;  // The type for iterating through the container
+  using const_iterator =
+      const T *;  // The constant type for iterating through the container
+
+  // Member functions
+  Vector();                                 // Default constructor
+  explicit Vector(const Allocator &alloc);  // Allocator constructor
+  explicit Vector(size_type n);             // Parameterized constructor
+  Vector(std::initializer_list<value_type> const
+             &items);           // Initializer list constructor
+  Vector(const Vector &v);      // Copy constructor
+  Vector(Vector &&v) noexcept;  // Move constructor
+  ~Vector();                    // Destructor
+  Vector &operator=(
+      Vector &&v) noexcept;  // Assignment operator overload for moving object
+
+  allocator_type get_allocator() const;  // Returns the associated allocator
+
+  // Element access
+  reference at(size_type pos);  // Access specified element with bounds check
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);  // Access specified element
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;  // Access the first element
+  const_reference back() const;   // Access the last element
+  T *data() noexcept;             // Direct access to the underlying array
+  const T *data() const noexcept;
+
+  // Iterators
+  iterator begin() noexcept;  // Returns an iterator to the beginning
+  iterator end() noexcept;    // Returns an iterator to the end
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the container is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type max_size()
+      const noexcept;  // Returns the maximum possible number of elements
+  void reserve(size_type size);  // Allocates storage of size elements and
+                                 // copies current array elements to a newly
+                                 // allocated array
+  size_type capacity() const noexcept;  // Returns the number of elements that
+                                        // can be held in allocated storage
+  void shrink_to_fit();  // Reduces memory usage by freeing unused memory
+
+  // Modifiers
+  void clear() noexcept;  // Clears the contents
+  iterator insert(
+      iterator pos,
+      const_reference value);  // Inserts element into concrete pos and returns
+                               // the iterator that points to the new element
+  iterator insert(iterator pos,
+                  value_type &&value);  // Moves element into concrete pos
+  template <class... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // Constructs element in-place before pos
+  void erase(iterator pos);          // Erases element at pos
+  void push_back(const_reference value);  // Adds an element to the end
+  void push_back(value_type &&value);     // Moves an element to the end
+  template <class... Args>
+  reference emplace_back(
+      Args &&...args);  // Constructs an element in-place at the end
+  void pop_back();      // Removes the last element
+  void swap(Vector &other) noexcept;  // Swaps the contents
+
+  // Bonus
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos,
+                       Args &&...args);  // Inserts new elements into the
+                                         // container directly before pos
+  template <class... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+
+  // Instrumentation
+  ContainerStats stats() const noexcept;  // Returns a snapshot of the
+                                          // counters of the Stats policy
+
+ private:
+  size_type grown_capacity(
+      size_type min) const;  // Next geometric capacity that holds min elements
+  void reallocate(size_type capacity);  // Relocates elements into a new array
+  void adopt(value_type *buffer,
+             size_type capacity) noexcept;  // Frees the old array and takes
+                                            // over buffer
+  void release() noexcept;  // Frees the array
+
+  // attributes
+  Allocator alloc_;
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+};
+
+// Member functions
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector() : Vector(Allocator()) {}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector(const Allocator &alloc)
+    : Stats("Vector"),
+      alloc_(alloc),
+      data_(nullptr),
+      size_(0),
+      capacity_(0) {}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector(size_type n) : Vector() {
+  reserve(n);
+  for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector(
+    std::initializer_list<value_type> const &items)
+    : Vector() {
+  reserve(items.size());
+  for (const auto &item : items) push_back(item);
+}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector(const Vector &v)
+    : Vector(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  for (auto it = v.cbegin(); it != v.cend(); ++it) push_back(*it);
+}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::Vector(Vector &&v) noexcept
+    : Stats("Vector"),
+      alloc_(std::move(v.alloc_)),
+      data_(v.data_),
+      size_(v.size_),
+      capacity_(v.capacity_) {
+  Stats::on_transfer(v, capacity_ * sizeof(value_type));
+  Stats::on_size(size_);
+  v.data_ = nullptr;
+  v.size_ = v.capacity_ = 0;
+}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>::~Vector() {
+  clear();
+  release();
+}
+
+template <class value_type, class Allocator, class Stats>
+Vector<value_type, Allocator, Stats>
+    &Vector<value_type, Allocator, Stats>::operator=(Vector &&v) noexcept {
+  swap(v);
+  return *this;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::allocator_type
+Vector<value_type, Allocator, Stats>::get_allocator() const {
+  return alloc_;
+}
+
+// Element access
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::reference
+Vector<value_type, Allocator, Stats>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_reference
+Vector<value_type, Allocator, Stats>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::reference
+Vector<value_type, Allocator, Stats>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_reference
+Vector<value_type, Allocator, Stats>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_reference
+Vector<value_type, Allocator, Stats>::front() const {
+  return data_[0];
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_reference
+Vector<value_type, Allocator, Stats>::back() const {
+  return data_[size_ - 1];
+}
+
+template <class value_type, class Allocator, class Stats>
+value_type *Vector<value_type, Allocator, Stats>::data() noexcept {
+  return data_;
+}
+
+template <class value_type, class Allocator, class Stats>
+const value_type *Vector<value_type, Allocator, Stats>::data() const noexcept {
+  return data_;
+}
+
+// Iterators
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::begin() noexcept {
+  return data_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::end() noexcept {
+  return data_ + size_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_iterator
+Vector<value_type, Allocator, Stats>::cbegin() const noexcept {
+  return data_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::const_iterator
+Vector<value_type, Allocator, Stats>::cend() const noexcept {
+  return data_ + size_;
+}
+
+// Capacity
+
+template <class value_type, class Allocator, class Stats>
+bool Vector<value_type, Allocator, Stats>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::size_type
+Vector<value_type, Allocator, Stats>::size() const noexcept {
+  return size_;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::size_type
+Vector<value_type, Allocator, Stats>::max_size() const noexcept {
+  return alloc_traits::max_size(alloc_);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::reserve(size_type size) {
+  if (size > max_size()) throw std::length_error("Size exceeds max_size");
+  if (size > capacity_) reallocate(size);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::size_type
+Vector<value_type, Allocator, Stats>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::shrink_to_fit() {
+  if (capacity_ > size_) reallocate(size_);
+}
+
+// Modifiers
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
+    }
+  }
+  size_ = 0;
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::insert(iterator pos,
+                                             const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::emplace(const_iterator pos,
+                                              Args &&...args) {
+  size_type index = pos - data_;
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return data_ + index;
+  }
+  value_type temp(std::forward<Args>(args)...);
+  if (size_ == capacity_) reallocate(grown_capacity(size_ + 1));
+  internal::insert_shifting(alloc_, data_, size_, index, std::move(temp));
+  Stats::on_size(++size_);
+  return data_ + index;
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::erase(iterator pos) {
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// The new element is constructed before the old ones are relocated, so an
+// argument that refers into the vector itself stays valid.
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename Vector<value_type, Allocator, Stats>::reference
+Vector<value_type, Allocator, Stats>::emplace_back(Args &&...args) {
+  if (size_ < capacity_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+  } else {
+    size_type capacity = grown_capacity(size_ + 1);
+    value_type *buffer = internal::grow_into(
+        alloc_, data_, size_, capacity, [&](value_type *&out) {
+          alloc_traits::construct(alloc_, out, std::forward<Args>(args)...);
+          ++out;
+        });
+    adopt(buffer, capacity);
+  }
+  Stats::on_size(size_ + 1);
+  return data_[size_++];
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::pop_back() {
+  if (size_ > 0) alloc_traits::destroy(alloc_, data_ + --size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::swap(Vector &other) noexcept {
+  Stats::on_transfer(other, other.capacity_ * sizeof(value_type));
+  other.Stats::on_transfer(*this, capacity_ * sizeof(value_type));
+  std::swap(alloc_, other.alloc_);
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  Stats::on_size(size_);
+  other.Stats::on_size(other.size_);
+}
+
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+typename Vector<value_type, Allocator, Stats>::iterator
+Vector<value_type, Allocator, Stats>::insert_many(const_iterator pos,
+                                           Args &&...args) {
+  return internal::insert_many(*this, pos, std::forward<Args>(args)...);
+}
+
+// Like emplace_back, the new elements are built in the new storage before the
+// old buffer is released, so the arguments may refer into the vector itself.
+template <class value_type, class Allocator, class Stats>
+template <class... Args>
+void Vector<value_type, Allocator, Stats>::insert_many_back(Args &&...args) {
+  if (size_ + sizeof...(Args) <= capacity_) {
+    (emplace_back(std::forward<Args>(args)), ...);
+    return;
+  }
+  size_type capacity = grown_capacity(size_ + sizeof...(Args));
+  value_type *buffer = internal::grow_into(
+      alloc_, data_, size_, capacity, [&](value_type *&out) {
+        ((alloc_traits::construct(alloc_, out, std::forward<Args>(args)),
+          ++out),
+         ...);
+      });
+  adopt(buffer, capacity);
+  size_ += sizeof...(Args);
+  Stats::on_size(size_);
+}
+
+// Instrumentation
+
+template <class value_type, class Allocator, class Stats>
+ContainerStats Vector<value_type, Allocator, Stats>::stats() const noexcept {
+  return Stats::snapshot();
+}
+
+// Storage management
+
+template <class value_type, class Allocator, class Stats>
+typename Vector<value_type, Allocator, Stats>::size_type
+Vector<value_type, Allocator, Stats>::grown_capacity(size_type min) const {
+  return internal::grown_capacity(capacity_, min, max_size());
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::reallocate(size_type capacity) {
+  value_type *buffer =
+      capacity > 0 ? alloc_traits::allocate(alloc_, capacity) : nullptr;
+  if (data_) {
+    try {
+      internal::relocate(data_, data_ + size_, buffer);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, buffer, capacity);
+      throw;
+    }
+  }
+  adopt(buffer, capacity);
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::adopt(value_type *buffer,
+                                                 size_type capacity) noexcept {
+  release();
+  if (buffer) Stats::on_allocate(capacity * sizeof(value_type));
+  data_ = buffer;
+  capacity_ = capacity;
+}
+
+template <class value_type, class Allocator, class Stats>
+void Vector<value_type, Allocator, Stats>::release() noexcept {
+  if (!data_) return;
+  alloc_traits::deallocate(alloc_, data_, capacity_);
+  Stats::on_deallocate(capacity_ * sizeof(value_type));
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_VECTOR_H_
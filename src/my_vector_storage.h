@@ -0,0 +1,110 @@
+#ifndef SRC_MY_VECTOR_STORAGE_H_
+#define SRC_MY_VECTOR_STORAGE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mynamespace {
+
+// Storage management shared by Vector and SmallVector, which differ only in
+// where their elements may live.
+namespace internal {
+
+// Next geometric capacity that holds min elements: twice the current one,
+// capped at max_size.
+inline size_t grown_capacity(size_t capacity, size_t min, size_t max_size) {
+  if (min > max_size) throw std::length_error("Size exceeds max_size");
+  size_t grown = capacity > max_size / 2 ? max_size : capacity * 2;
+  return grown < min ? min : grown;
+}
+
+// Moves [first, last) into uninitialized dest and destroys the source.
+// Trivially copyable elements are relocated with a single memcpy. Others are
+// moved when that cannot throw and copied otherwise; the source is destroyed
+// only once every element has been transferred, so a throwing copy leaves it
+// intact.
+template <class T>
+void relocate(T *first, T *last, T *dest) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), first,
+                  (last - first) * sizeof(T));
+    }
+  } else {
+    T *out = dest;
+    try {
+      for (T *p = first; p != last; ++p, ++out) {
+        ::new (static_cast<void *>(out)) T(std::move_if_noexcept(*p));
+      }
+    } catch (...) {
+      for (T *p = dest; p != out; ++p) p->~T();
+      throw;
+    }
+    for (T *p = first; p != last; ++p) p->~T();
+  }
+}
+
+// Allocates capacity elements and lets build construct the new ones from
+// buffer + size onwards, advancing the pointer it is given past each. Only
+// then are the size old elements relocated in front of them, so arguments
+// that refer into the old storage stay valid; releasing that storage is left
+// to the caller. On failure nothing has changed.
+template <class Allocator, class T, class Build>
+T *grow_into(Allocator &alloc, T *data, size_t size, size_t capacity,
+             Build build) {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  T *buffer = alloc_traits::allocate(alloc, capacity);
+  T *out = buffer + size;
+  try {
+    build(out);
+    relocate(data, data + size, buffer);
+  } catch (...) {
+    for (T *p = buffer + size; p != out; ++p) alloc_traits::destroy(alloc, p);
+    alloc_traits::deallocate(alloc, buffer, capacity);
+    throw;
+  }
+  return buffer;
+}
+
+// Moves value into data[index] after shifting [index, size) one slot right;
+// data[size] must be uninitialized storage.
+template <class Allocator, class T>
+void insert_shifting(Allocator &alloc, T *data, size_t size, size_t index,
+                     T &&value) {
+  std::allocator_traits<Allocator>::construct(alloc, data + size,
+                                              std::move(data[size - 1]));
+  std::move_backward(data + index, data + size - 1, data + size);
+  data[index] = std::move(value);
+}
+
+// The arguments are materialised before anything is shifted or reallocated,
+// so they may refer into the container itself.
+template <class Container, class... Args>
+typename Container::iterator insert_many(
+    Container &c, typename Container::const_iterator pos, Args &&...args) {
+  size_t index = pos - c.data();
+  typename Container::iterator it = c.data() + index;
+  if constexpr (sizeof...(Args) > 0) {
+    typename Container::value_type items[] = {
+        typename Container::value_type(std::forward<Args>(args))...};
+    size_t size = c.size() + sizeof...(Args);
+    if (size > c.capacity()) {
+      c.reserve(grown_capacity(c.capacity(), size, c.max_size()));
+    }
+    it = c.data() + index;
+    for (auto &item : items) it = c.emplace(it, std::move(item)) + 1;
+  }
+  return it;
+}
+
+}  // namespace internal
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_VECTOR_STORAGE_H_
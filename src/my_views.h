@@ -0,0 +1,679 @@
+#ifndef SRC_MY_VIEWS_H_
+#define SRC_MY_VIEWS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mynamespace {
+
+// Lazy views over the elements of a container, in the manner of C++20
+// ranges. An adaptor is applied with operator| and builds a view holding
+// its base view and arguments; elements are produced one at a time as the
+// view is iterated, so a pipeline such as
+//
+//   list | views::filter(even) | views::transform(square) | views::take(10)
+//
+// allocates nothing. Adaptors compose with operator| before being applied,
+// and to<List>() materializes a view into a container.
+//
+// A container on the left of the first | is referred to, not copied, and
+// must outlive the view; a temporary container is moved into the view.
+// Queue and Stack contribute their containers, front to back and bottom to
+// top. Views over a const container yield const elements. As with the
+// standard views, an iterator refers to its view and is invalidated when
+// the view is destroyed, and modifying the container invalidates the views
+// over it.
+//
+// filter, transform, drop and reverse keep bidirectional iteration; take,
+// zip and chunk are forward only, so reverse must come before them.
+namespace views {
+
+namespace internal {
+
+struct ViewBase {};  // Base of every view, to tell views from containers
+
+template <class R>
+constexpr bool is_view_v = std::is_base_of_v<ViewBase, std::decay_t<R>>;
+
+template <class C>
+auto contents(C &c, int) -> decltype(c.container()) {
+  return c.container();
+}  // The container of an adapter
+
+template <class C>
+C &contents(C &c, long) {
+  return c;
+}  // Any other container itself
+
+template <class C>
+auto first(C &c) {
+  auto &range = contents(c, 0);
+  if constexpr (std::is_const_v<std::remove_reference_t<decltype(range)>>) {
+    return range.cbegin();
+  } else {
+    return range.begin();
+  }
+}
+
+template <class C>
+auto last(C &c) {
+  auto &range = contents(c, 0);
+  if constexpr (std::is_const_v<std::remove_reference_t<decltype(range)>>) {
+    return range.cend();
+  } else {
+    return range.end();
+  }
+}
+
+template <class V>
+using iterator_t = decltype(std::declval<const V &>().begin());
+
+template <class V>
+using traits_t = std::iterator_traits<iterator_t<V>>;
+
+// The category of It, capped at Max as the view implements no more.
+template <class It, class Max>
+using category_t = std::conditional_t<
+    std::is_base_of_v<Max,
+                      typename std::iterator_traits<It>::iterator_category>,
+    Max, typename std::iterator_traits<It>::iterator_category>;
+
+template <class It>
+constexpr bool is_bidirectional_v = std::is_base_of_v<
+    std::bidirectional_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category>;
+
+template <class V, class = void>
+struct is_sized : std::false_type {};
+
+template <class V>
+struct is_sized<V, std::void_t<decltype(std::declval<const V &>().size())>>
+    : std::true_type {};
+
+template <class V>
+constexpr bool is_sized_v = is_sized<V>::value;
+
+template <class It>
+It advance_up_to(It it, It last, size_t n) {
+  for (; n > 0 && it != last; --n) ++it;
+  return it;
+}  // Advances by n, stopping at last
+
+}  // namespace internal
+
+// Views of containers
+
+template <class C>
+class RefView : public internal::ViewBase {
+ public:
+  explicit RefView(C &c) : c_(&c) {}
+
+  auto begin() const { return internal::first(*c_); }
+  auto end() const { return internal::last(*c_); }
+  size_t size() const { return internal::contents(*c_, 0).size(); }
+
+ private:
+  C *c_;
+};  // A container referred to by the view
+
+template <class C>
+class OwningView : public internal::ViewBase {
+ public:
+  explicit OwningView(C &&c) : c_(std::make_shared<C>(std::move(c))) {}
+
+  auto begin() const { return internal::first(*c_); }
+  auto end() const { return internal::last(*c_); }
+  size_t size() const { return internal::contents(*c_, 0).size(); }
+
+ private:
+  std::shared_ptr<C> c_;  // Shared by copies of the view
+};  // A temporary container moved into the view
+
+template <class It>
+class Subrange : public internal::ViewBase {
+ public:
+  Subrange() = default;
+  Subrange(It first, It last) : first_(first), last_(last) {}
+
+  It begin() const { return first_; }
+  It end() const { return last_; }
+
+ private:
+  It first_{};
+  It last_{};
+};  // A pair of iterators, the elements of chunk
+
+template <class R>
+auto all(R &&r) {
+  if constexpr (internal::is_view_v<R>) {
+    return std::decay_t<R>(std::forward<R>(r));
+  } else if constexpr (std::is_lvalue_reference_v<R>) {
+    return RefView<std::remove_reference_t<R>>(r);
+  } else {
+    return OwningView<std::decay_t<R>>(std::move(r));
+  }
+}  // The view of a container, or the view itself
+
+// Adaptors
+
+template <class V, class Pred>
+class FilterView : public internal::ViewBase {
+  using base_iterator = internal::iterator_t<V>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category =
+        internal::category_t<base_iterator, std::bidirectional_iterator_tag>;
+    using value_type = typename internal::traits_t<V>::value_type;
+    using difference_type = typename internal::traits_t<V>::difference_type;
+    using pointer = typename internal::traits_t<V>::pointer;
+    using reference = typename internal::traits_t<V>::reference;
+
+    iterator() = default;
+    iterator(const FilterView *view, base_iterator it)
+        : view_(view), it_(it) {}
+
+    reference operator*() const { return *it_; }
+    iterator &operator++() {
+      base_iterator last = view_->base_.end();
+      do {
+        ++it_;
+      } while (it_ != last && !view_->pred_(*it_));
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    iterator &operator--() {
+      do {
+        --it_;
+      } while (!view_->pred_(*it_));
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator copy = *this;
+      --*this;
+      return copy;
+    }
+    bool operator==(const iterator &other) const { return it_ == other.it_; }
+    bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+   private:
+    const FilterView *view_ = nullptr;
+    base_iterator it_{};
+  };
+
+  FilterView(V base, Pred pred) : base_(std::move(base)), pred_(pred) {}
+
+  iterator begin() const {
+    base_iterator it = base_.begin();
+    base_iterator last = base_.end();
+    while (it != last && !pred_(*it)) ++it;
+    return iterator(this, it);
+  }  // Walks to the first element satisfying pred
+  iterator end() const { return iterator(this, base_.end()); }
+
+ private:
+  V base_;
+  Pred pred_;
+};  // The elements satisfying pred
+
+template <class V, class Function>
+class TransformView : public internal::ViewBase {
+  using base_iterator = internal::iterator_t<V>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category =
+        internal::category_t<base_iterator, std::bidirectional_iterator_tag>;
+    using reference = decltype(std::declval<const Function &>()(
+        *std::declval<base_iterator>()));
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using difference_type = typename internal::traits_t<V>::difference_type;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(const TransformView *view, base_iterator it)
+        : view_(view), it_(it) {}
+
+    reference operator*() const { return view_->f_(*it_); }
+    iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++it_;
+      return copy;
+    }
+    iterator &operator--() {
+      --it_;
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator copy = *this;
+      --it_;
+      return copy;
+    }
+    bool operator==(const iterator &other) const { return it_ == other.it_; }
+    bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+   private:
+    const TransformView *view_ = nullptr;
+    base_iterator it_{};
+  };
+
+  TransformView(V base, Function f) : base_(std::move(base)), f_(f) {}
+
+  iterator begin() const { return iterator(this, base_.begin()); }
+  iterator end() const { return iterator(this, base_.end()); }
+  template <class B = V, class = std::enable_if_t<internal::is_sized_v<B>>>
+  size_t size() const {
+    return base_.size();
+  }
+
+ private:
+  V base_;
+  Function f_;
+};  // f of every element, computed on each dereference
+
+template <class V>
+class TakeView : public internal::ViewBase {
+  using base_iterator = internal::iterator_t<V>;
+
+ public:
+  // Counts its position, so the end is known without walking to it: an
+  // iterator is at the end once it has counted n or reached the base end.
+  // The n-th increment leaves the base iterator alone, so a filter below
+  // is not searched past the last element taken. Iterators before the end
+  // compare by position.
+  class iterator {
+   public:
+    using iterator_category =
+        internal::category_t<base_iterator, std::forward_iterator_tag>;
+    using value_type = typename internal::traits_t<V>::value_type;
+    using difference_type = typename internal::traits_t<V>::difference_type;
+    using pointer = typename internal::traits_t<V>::pointer;
+    using reference = typename internal::traits_t<V>::reference;
+
+    iterator() = default;
+    iterator(base_iterator it, base_iterator last, size_t pos, size_t n)
+        : it_(it), last_(last), pos_(pos), n_(n) {}
+
+    reference operator*() const { return *it_; }
+    iterator &operator++() {
+      if (++pos_ < n_) ++it_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    bool operator==(const iterator &other) const {
+      if (at_end() || other.at_end()) return at_end() && other.at_end();
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+   private:
+    bool at_end() const { return pos_ == n_ || it_ == last_; }
+
+    base_iterator it_{};
+    base_iterator last_{};
+    size_t pos_ = 0;
+    size_t n_ = 0;
+  };
+
+  TakeView(V base, size_t n) : base_(std::move(base)), n_(n) {}
+
+  iterator begin() const {
+    return iterator(base_.begin(), base_.end(), 0, n_);
+  }
+  iterator end() const { return iterator(base_.end(), base_.end(), n_, n_); }
+  template <class B = V, class = std::enable_if_t<internal::is_sized_v<B>>>
+  size_t size() const {
+    return std::min(n_, base_.size());
+  }
+
+ private:
+  V base_;
+  size_t n_;
+};  // The first n elements, or all if there are fewer
+
+template <class V>
+class DropView : public internal::ViewBase {
+ public:
+  DropView(V base, size_t n) : base_(std::move(base)), n_(n) {}
+
+  auto begin() const {
+    return internal::advance_up_to(base_.begin(), base_.end(), n_);
+  }  // Walks past the first n elements
+  auto end() const { return base_.end(); }
+  template <class B = V, class = std::enable_if_t<internal::is_sized_v<B>>>
+  size_t size() const {
+    return base_.size() - std::min(n_, base_.size());
+  }
+
+ private:
+  V base_;
+  size_t n_;
+};  // All but the first n elements
+
+template <class V>
+class ReverseView : public internal::ViewBase {
+  static_assert(internal::is_bidirectional_v<internal::iterator_t<V>>,
+                "reverse needs a bidirectional view: apply it before take, "
+                "zip or chunk");
+
+ public:
+  explicit ReverseView(V base) : base_(std::move(base)) {}
+
+  auto begin() const { return std::make_reverse_iterator(base_.end()); }
+  auto end() const { return std::make_reverse_iterator(base_.begin()); }
+  template <class B = V, class = std::enable_if_t<internal::is_sized_v<B>>>
+  size_t size() const {
+    return base_.size();
+  }
+
+ private:
+  V base_;
+};  // The elements last to first
+
+template <class V1, class V2>
+class ZipView : public internal::ViewBase {
+  using iterator1 = internal::iterator_t<V1>;
+  using iterator2 = internal::iterator_t<V2>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<typename internal::traits_t<V1>::value_type,
+                                 typename internal::traits_t<V2>::value_type>;
+    using reference = std::pair<typename internal::traits_t<V1>::reference,
+                                typename internal::traits_t<V2>::reference>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(iterator1 it1, iterator1 last1, iterator2 it2, iterator2 last2)
+        : it1_(it1), last1_(last1), it2_(it2), last2_(last2) {}
+
+    reference operator*() const { return reference(*it1_, *it2_); }
+    iterator &operator++() {
+      ++it1_;
+      ++it2_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    bool operator==(const iterator &other) const {
+      if (at_end() || other.at_end()) return at_end() && other.at_end();
+      return it1_ == other.it1_ && it2_ == other.it2_;
+    }
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+   private:
+    bool at_end() const {
+      return it1_ == last1_ || it2_ == last2_;
+    }  // Either side at its end ends the zip
+
+    iterator1 it1_{};
+    iterator1 last1_{};
+    iterator2 it2_{};
+    iterator2 last2_{};
+  };
+
+  ZipView(V1 base1, V2 base2)
+      : base1_(std::move(base1)), base2_(std::move(base2)) {}
+
+  iterator begin() const {
+    return iterator(base1_.begin(), base1_.end(), base2_.begin(), base2_.end());
+  }
+  iterator end() const {
+    return iterator(base1_.end(), base1_.end(), base2_.end(), base2_.end());
+  }
+  template <class B1 = V1, class B2 = V2,
+            class = std::enable_if_t<internal::is_sized_v<B1> &&
+                                     internal::is_sized_v<B2>>>
+  size_t size() const {
+    return std::min(base1_.size(), base2_.size());
+  }
+
+ private:
+  V1 base1_;
+  V2 base2_;
+};  // Pairs of references to the elements of two views, as long as the
+    // shorter one
+
+template <class V>
+class ChunkView : public internal::ViewBase {
+  using base_iterator = internal::iterator_t<V>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Subrange<base_iterator>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(base_iterator it, base_iterator last, size_t n)
+        : it_(it), next_(internal::advance_up_to(it, last, n)),
+          last_(last), n_(n) {}
+
+    reference operator*() const { return value_type(it_, next_); }
+    iterator &operator++() {
+      it_ = next_;
+      next_ = internal::advance_up_to(next_, last_, n_);
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    bool operator==(const iterator &other) const { return it_ == other.it_; }
+    bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+   private:
+    base_iterator it_{};
+    base_iterator next_{};  // The end of the current chunk
+    base_iterator last_{};
+    size_t n_ = 1;
+  };
+
+  ChunkView(V base, size_t n)
+      : base_(std::move(base)), n_(std::max<size_t>(n, 1)) {}
+
+  iterator begin() const {
+    return iterator(base_.begin(), base_.end(), n_);
+  }
+  iterator end() const { return iterator(base_.end(), base_.end(), n_); }
+  template <class B = V, class = std::enable_if_t<internal::is_sized_v<B>>>
+  size_t size() const {
+    return (base_.size() + n_ - 1) / n_;
+  }
+
+ private:
+  V base_;
+  size_t n_;
+};  // Consecutive subranges of n elements, the last one possibly shorter
+
+// Pipes
+
+// A view adaptor waiting for its range: make is called with the view of
+// the range on the left of |.
+template <class Make>
+class Adaptor {
+ public:
+  explicit Adaptor(Make make) : make_(make) {}
+
+  template <class R>
+  auto operator()(R &&r) const {
+    return make_(all(std::forward<R>(r)));
+  }
+
+ private:
+  Make make_;
+};
+
+template <class T>
+struct is_adaptor : std::false_type {};
+
+template <class Make>
+struct is_adaptor<Adaptor<Make>> : std::true_type {};
+
+template <class R, class Make,
+          class = std::enable_if_t<!is_adaptor<std::decay_t<R>>::value>>
+auto operator|(R &&r, const Adaptor<Make> &adaptor) {
+  return adaptor(std::forward<R>(r));
+}  // Applies an adaptor to a container or view
+
+template <class Make1, class Make2>
+auto operator|(const Adaptor<Make1> &first, const Adaptor<Make2> &second) {
+  auto make = [first, second](auto view) { return second(first(view)); };
+  return Adaptor<decltype(make)>(make);
+}  // Composes two adaptors into one applying first, then second
+
+template <class Pred>
+auto filter(Pred pred) {
+  auto make = [pred](auto view) {
+    return FilterView<decltype(view), Pred>(std::move(view), pred);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // The elements satisfying pred
+
+template <class Function>
+auto transform(Function f) {
+  auto make = [f](auto view) {
+    return TransformView<decltype(view), Function>(std::move(view), f);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // f of every element
+
+inline auto take(size_t n) {
+  auto make = [n](auto view) {
+    return TakeView<decltype(view)>(std::move(view), n);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // The first n elements
+
+inline auto drop(size_t n) {
+  auto make = [n](auto view) {
+    return DropView<decltype(view)>(std::move(view), n);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // All but the first n elements
+
+inline auto reverse() {
+  auto make = [](auto view) {
+    return ReverseView<decltype(view)>(std::move(view));
+  };
+  return Adaptor<decltype(make)>(make);
+}  // The elements last to first
+
+template <class R>
+auto zip(R &&other) {
+  auto make = [second = all(std::forward<R>(other))](auto view) {
+    return ZipView<decltype(view), decltype(second)>(std::move(view),
+                                                     second);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // Pairs of elements of the range on the left and of other
+
+inline auto chunk(size_t n) {
+  auto make = [n](auto view) {
+    return ChunkView<decltype(view)>(std::move(view), n);
+  };
+  return Adaptor<decltype(make)>(make);
+}  // Subranges of n elements
+
+// Materialization
+
+namespace internal {
+
+template <class C, class It>
+auto append(C &c, It first, It last, int)
+    -> decltype(c.push_range(first, last), void()) {
+  c.push_range(first, last);
+}  // Queue and Stack
+
+template <class C, class It>
+auto append(C &c, It first, It last, long)
+    -> decltype(c.insert(c.cend(), first, last), void()) {
+  c.insert(c.cend(), first, last);
+}  // Range insert of containers such as List, which links once
+
+template <class C, class It>
+void append(C &c, It first, It last, ...) {
+  for (; first != last; ++first) c.push_back(*first);
+}  // Element by element for the others
+
+template <class C>
+auto reserve(C &c, size_t n, int) -> decltype(c.reserve(n), void()) {
+  c.reserve(n);
+}
+
+template <class C>
+void reserve(C &, size_t, long) {}
+
+template <class C, class R>
+C materialize(R &&r) {
+  auto view = all(std::forward<R>(r));
+  C c;
+  if constexpr (is_sized_v<decltype(view)>) reserve(c, view.size(), 0);
+  append(c, view.begin(), view.end(), 0);
+  return c;
+}
+
+}  // namespace internal
+
+template <class C>
+struct To {};  // Materializer into C
+
+template <template <class...> class C>
+struct ToTemplate {};  // Materializer into C of the element type
+
+template <class R, class C>
+C operator|(R &&r, To<C>) {
+  return internal::materialize<C>(std::forward<R>(r));
+}
+
+template <class R, template <class...> class C>
+auto operator|(R &&r, ToTemplate<C>) {
+  using view_type = decltype(all(std::forward<R>(r)));
+  using value_type = typename internal::traits_t<view_type>::value_type;
+  return internal::materialize<C<value_type>>(std::forward<R>(r));
+}
+
+}  // namespace views
+
+template <class C>
+views::To<C> to() {
+  return {};
+}  // Materializes a view into a C, reserving first if C has reserve and
+   // the view knows its size; a List links all its new nodes at once
+
+template <template <class...> class C>
+views::ToTemplate<C> to() {
+  return {};
+}  // Materializes a view into a C of the element type, as in to<List>()
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_VIEWS_H_
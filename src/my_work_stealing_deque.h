@@ -0,0 +1,188 @@
+#ifndef SRC_MY_WORK_STEALING_DEQUE_H_
+#define SRC_MY_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "my_cache_line.h"
+#include "my_vector.h"
+
+namespace mynamespace {
+
+// Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+// bottom without locking; any number of thieves steal from the top, and only
+// a steal and a pop that race for the last element meet on a CAS. The ring
+// buffer doubles when full. Thieves may still read an outgrown buffer, so
+// buffers are freed only when the deque is destroyed.
+//
+// The indices use sequentially consistent operations where Le et al. place
+// standalone fences, which costs the same on x86 and keeps ThreadSanitizer
+// able to check the deque. Slots are read and written concurrently, so
+// value_type must be trivially copyable; a task pointer or an index of at
+// most 8 bytes keeps them lock-free.
+template <class T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "WorkStealingDeque needs a trivially copyable value_type");
+
+ public:
+  // Member types
+  using value_type = T;      // The type of an element
+  using size_type = size_t;  // The type of the container size
+
+  // Member functions
+  explicit WorkStealingDeque(
+      size_type capacity = 64);  // Parameterized constructor
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+  ~WorkStealingDeque();  // Destructor
+
+  // Capacity
+  bool empty() const noexcept;      // Checks whether the deque is empty
+  size_type size() const noexcept;  // Returns the number of elements
+  size_type capacity() const noexcept;  // Returns the buffer size
+
+  // Owner
+  void push(value_type value);  // Inserts element at the bottom
+  bool pop(value_type &value);  // Takes the bottom element unless empty
+
+  // Thieves
+  bool steal(value_type &value);  // Takes the top element unless empty or
+                                  // lost to a concurrent pop or steal
+
+ private:
+  struct Buffer {
+    explicit Buffer(size_type size)
+        : mask_(size - 1), slots_(new std::atomic<value_type>[size]) {}
+    ~Buffer() { delete[] slots_; }
+
+    value_type get(std::int64_t pos) const noexcept {
+      return slots_[pos & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t pos, value_type value) noexcept {
+      slots_[pos & mask_].store(value, std::memory_order_relaxed);
+    }
+    std::int64_t size() const noexcept {
+      return static_cast<std::int64_t>(mask_ + 1);
+    }
+
+    size_type mask_;
+    std::atomic<value_type> *slots_;
+  };
+
+  Buffer *grow(Buffer *buffer, std::int64_t bottom,
+               std::int64_t top);  // Replaces a full buffer
+
+  // attributes
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_;
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_;
+  std::atomic<Buffer *> buffer_;
+  Vector<Buffer *> retired_;  // Outgrown buffers, owned by the owner thread
+};
+
+template <class value_type>
+WorkStealingDeque<value_type>::WorkStealingDeque(size_type capacity)
+    : top_(0), bottom_(0), buffer_(nullptr) {
+  size_type size = 2;
+  while (size < capacity) size *= 2;
+  buffer_.store(new Buffer(size), std::memory_order_relaxed);
+}
+
+template <class value_type>
+WorkStealingDeque<value_type>::~WorkStealingDeque() {
+  delete buffer_.load(std::memory_order_relaxed);
+  for (Buffer *buffer : retired_) delete buffer;
+}
+
+// Capacity
+
+template <class value_type>
+bool WorkStealingDeque<value_type>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class value_type>
+typename WorkStealingDeque<value_type>::size_type
+WorkStealingDeque<value_type>::size() const noexcept {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <class value_type>
+typename WorkStealingDeque<value_type>::size_type
+WorkStealingDeque<value_type>::capacity() const noexcept {
+  return static_cast<size_type>(
+      buffer_.load(std::memory_order_relaxed)->size());
+}
+
+// Owner
+
+template <class value_type>
+void WorkStealingDeque<value_type>::push(value_type value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top > buffer->size() - 1) buffer = grow(buffer, bottom, top);
+  buffer->put(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <class value_type>
+bool WorkStealingDeque<value_type>::pop(value_type &value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  bool taken = top <= bottom;
+  if (taken) {
+    value_type popped = buffer->get(bottom);
+    if (top == bottom) {
+      // Last element: a thief may be after it too.
+      taken = top_.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    if (taken) value = popped;
+  } else {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return taken;
+}
+
+// Thieves
+
+template <class value_type>
+bool WorkStealingDeque<value_type>::steal(value_type &value) {
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Buffer *buffer = buffer_.load(std::memory_order_acquire);
+  value_type stolen = buffer->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  value = stolen;
+  return true;
+}
+
+template <class value_type>
+typename WorkStealingDeque<value_type>::Buffer *
+WorkStealingDeque<value_type>::grow(Buffer *buffer, std::int64_t bottom,
+                                    std::int64_t top) {
+  Buffer *bigger = new Buffer(2 * static_cast<size_type>(buffer->size()));
+  for (std::int64_t pos = top; pos != bottom; ++pos) {
+    bigger->put(pos, buffer->get(pos));
+  }
+  retired_.push_back(buffer);
+  buffer_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+}  // namespace mynamespace
+
+#endif  // SRC_MY_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "my_archive.h"
+#include "my_list.h"
+#include "my_queue.h"
+#include "my_stack.h"
+
+namespace {
+
+struct Point {
+  int32_t x;
+  int32_t y;
+  double weight;
+};
+
+std::string TempPath(const char *name) {
+  return testing::TempDir() + "my_archive_" + name;
+}
+
+template <class Container>
+std::vector<typename Container::value_type> Contents(const Container &c) {
+  return std::vector<typename Container::value_type>(c.cbegin(), c.cend());
+}
+
+// Overwrites one byte of a file.
+void Corrupt(const std::string &path, std::streamoff offset) {
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(offset);
+  char byte = static_cast<char>(file.get());
+  file.seekp(offset);
+  file.put(static_cast<char>(byte ^ 0x5A));
+}
+
+}  // namespace
+
+TEST(test_archive, ListRoundTrip) {
+  std::string path = TempPath("list");
+  mynamespace::List<int64_t> a;
+  for (int64_t i = 0; i < 100000; ++i) a.push_back(i * i - 7);
+  a.save(path);
+  mynamespace::List<int64_t> b{1, 2, 3};
+  b.load(path);
+  ASSERT_EQ(Contents(b), Contents(a));
+  mynamespace::List<int64_t>().save(path);
+  b.load(path);
+  ASSERT_TRUE(b.empty());
+  mynamespace::List<std::string> names{"Misha", "", "Max",
+                                       std::string(100000, 'x')};
+  names.save(path);
+  mynamespace::List<std::string> loaded;
+  loaded.load(path);
+  ASSERT_EQ(Contents(loaded), Contents(names));
+  mynamespace::List<Point> points{{1, 2, 0.5}, {-3, 4, 1e9}};
+  points.save(path);
+  mynamespace::List<Point> loaded_points;
+  loaded_points.load(path);
+  ASSERT_EQ(loaded_points.size(), 2U);
+  ASSERT_EQ(loaded_points.back().x, -3);
+  ASSERT_EQ(loaded_points.back().weight, 1e9);
+}
+
+TEST(test_archive, QueueAndStackRoundTrip) {
+  std::string path = TempPath("adapters");
+  mynamespace::Queue<double> q;
+  for (int i = 0; i < 50000; ++i) q.push(i / 4.0);
+  q.save(path);
+  mynamespace::Queue<double, mynamespace::List<double>> from_list;
+  from_list.load(path);
+  ASSERT_EQ(from_list.size(), 50000U);
+  ASSERT_EQ(from_list.front(), 0.0);
+  ASSERT_EQ(from_list.back(), 49999 / 4.0);
+  mynamespace::Queue<double> back;
+  back.load(path);
+  ASSERT_EQ(Contents(back.container()), Contents(q.container()));
+  mynamespace::Stack<std::string> s;
+  s.push("bottom");
+  s.push("top");
+  s.save(path);
+  mynamespace::Stack<std::string> t;
+  t.load(path);
+  ASSERT_EQ(t.size(), 2U);
+  ASSERT_EQ(t.top(), "top");
+  t.pop();
+  ASSERT_EQ(t.top(), "bottom");
+}
+
+TEST(test_archive, MappedView) {
+  std::string path = TempPath("mapped");
+  mynamespace::Queue<uint32_t> q;
+  for (uint32_t i = 0; i < 70000; ++i) q.push(i * 3);
+  q.save(path);
+  mynamespace::archive::MappedView<uint32_t> view(path);
+  ASSERT_EQ(view.size(), 70000U);
+  ASSERT_EQ(view.front(), 0U);
+  ASSERT_EQ(view.back(), 69999U * 3);
+  ASSERT_EQ(view[100], 300U);
+  uint32_t i = 0;
+  for (uint32_t x : view) ASSERT_EQ(x, 3 * i++);
+  mynamespace::archive::MappedView<uint32_t> moved(std::move(view));
+  ASSERT_TRUE(view.empty());
+  ASSERT_EQ(std::distance(moved.begin(), moved.end()), 70000);
+  mynamespace::List<uint32_t>().save(path);
+  mynamespace::archive::MappedView<uint32_t> empty(path);
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TEST(test_archive, RejectsBadArchives) {
+  using mynamespace::archive::Error;
+  std::string path = TempPath("bad");
+  mynamespace::List<int> a{1, 2, 3, 4, 5};
+  a.save(path);
+  mynamespace::List<unsigned> wrong_type;
+  ASSERT_THROW(wrong_type.load(path), Error);
+  ASSERT_THROW(mynamespace::archive::MappedView<int64_t>{path}, Error);
+  Corrupt(path, 64 + 9);
+  mynamespace::List<int> b{7};
+  ASSERT_THROW(b.load(path), Error);
+  ASSERT_EQ(Contents(b), std::vector<int>{7});
+  ASSERT_THROW(mynamespace::archive::MappedView<int>{path}, Error);
+  mynamespace::archive::MappedView<int> unchecked(path, false);
+  ASSERT_EQ(unchecked.size(), 5U);
+  std::ofstream(path, std::ios::app) << "trailing";
+  ASSERT_THROW(b.load(path), Error);
+  std::ofstream(path, std::ios::trunc) << "short";
+  ASSERT_THROW(b.load(path), Error);
+  mynamespace::Stack<int> s;
+  ASSERT_THROW(s.load(TempPath("missing")), Error);
+  ASSERT_THROW(a.save(TempPath("no_such_dir/list")), Error);
+  ASSERT_EQ(Contents(b), std::vector<int>{7});
+}
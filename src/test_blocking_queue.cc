@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "my_blocking_queue.h"
+#include "my_list.h"
+
+TEST(test_blocking_queue, SingleThread) {
+  mynamespace::BlockingQueue<std::string> a(2);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 2U);
+  ASSERT_TRUE(a.push("Misha"));
+  ASSERT_TRUE(a.try_emplace(3, 'x'));
+  ASSERT_FALSE(a.try_push("Max"));
+  ASSERT_EQ(a.size(), 2U);
+  std::string value;
+  ASSERT_TRUE(a.pop_wait(value));
+  ASSERT_EQ(value, "Misha");
+  ASSERT_TRUE(a.try_pop(value));
+  ASSERT_EQ(value, "xxx");
+  ASSERT_FALSE(a.try_pop(value));
+  ASSERT_FALSE(a.try_pop_for(value, std::chrono::milliseconds(1)));
+}
+
+TEST(test_blocking_queue, Batches) {
+  mynamespace::BlockingQueue<int, mynamespace::List<int>> a;
+  for (int i = 0; i < 10; ++i) a.push(i);
+  std::vector<int> out;
+  ASSERT_EQ(a.pop_up_to(std::back_inserter(out), 4), 4U);
+  ASSERT_EQ(a.pop_all(std::back_inserter(out)), 6U);
+  for (int i = 0; i < 10; ++i) ASSERT_EQ(out[i], i);
+}
+
+TEST(test_blocking_queue, CloseWakesConsumers) {
+  mynamespace::BlockingQueue<int> a;
+  a.push(1);
+  std::thread consumer([&a] {
+    int value;
+    std::vector<int> out;
+    ASSERT_TRUE(a.pop_wait(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_FALSE(a.pop_wait(value));
+    ASSERT_EQ(a.pop_all(std::back_inserter(out)), 0U);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  a.close();
+  consumer.join();
+  ASSERT_TRUE(a.closed());
+  ASSERT_FALSE(a.push(2));
+}
+
+TEST(test_blocking_queue, Backpressure) {
+  constexpr int kCount = 100000;
+  mynamespace::BlockingQueue<int> a(16);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 2; ++p) {
+    producers.emplace_back([&a, p] {
+      for (int i = 0; i < kCount; ++i) ASSERT_TRUE(a.push(p * kCount + i));
+    });
+  }
+  std::thread closer([&a, &producers] {
+    for (auto &producer : producers) producer.join();
+    a.close();
+  });
+  std::vector<int> seen(2 * kCount, 0);
+  std::vector<int> batch;
+  int last[2] = {-1, -1};
+  while (a.pop_up_to(std::back_inserter(batch), 7) > 0) {
+    ASSERT_LE(batch.size(), 7U);
+    ASSERT_LE(a.size(), a.capacity());
+    for (int value : batch) {
+      ++seen[value];
+      ASSERT_LT(last[value / kCount], value);
+      last[value / kCount] = value;
+    }
+    batch.clear();
+  }
+  closer.join();
+  for (int count : seen) ASSERT_EQ(count, 1);
+}
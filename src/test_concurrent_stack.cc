@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "my_concurrent_stack.h"
+
+TEST(test_concurrent_stack, SingleThread) {
+  mynamespace::ConcurrentStack<std::string> a;
+  ASSERT_TRUE(a.empty());
+  a.push("Misha");
+  std::string max = "Max";
+  a.push(max);
+  a.emplace(3, 'x');
+  a.insert_many_front("Sasha", "Nina");
+  std::string value;
+  ASSERT_TRUE(a.try_top(value));
+  ASSERT_EQ(value, "Nina");
+  for (const char *expected : {"Nina", "Sasha", "xxx", "Max"}) {
+    ASSERT_TRUE(a.try_pop(value));
+    ASSERT_EQ(value, expected);
+  }
+  ASSERT_TRUE(a.pop());
+  ASSERT_FALSE(a.pop());
+  ASSERT_FALSE(a.try_pop(value));
+  ASSERT_FALSE(a.try_top(value));
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_concurrent_stack, MoveOnly) {
+  mynamespace::ConcurrentStack<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(5));
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(a.try_pop(value));
+  ASSERT_EQ(*value, 5);
+}
+
+TEST(test_concurrent_stack, ReclaimsNodes) {
+  auto item = std::make_shared<int>(1);
+  {
+    mynamespace::ConcurrentStack<std::shared_ptr<int>> a;
+    for (int i = 0; i < 1000; ++i) {
+      a.push(item);
+      a.pop();
+    }
+    // Popped nodes are freed in batches, never more than the threshold late.
+    ASSERT_LE(item.use_count(),
+              1 + 2 * static_cast<long>(a.kHazardSlots));
+    a.push(item);
+  }
+  ASSERT_EQ(item.use_count(), 1);
+}
+
+// Every pushed item is popped exactly once while readers peek at the top.
+TEST(test_concurrent_stack, ManyThreadStress) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 50000;
+  mynamespace::ConcurrentStack<std::string> a;
+  std::vector<std::vector<int>> popped(kThreads);
+  std::atomic<bool> done(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&a, &popped, t] {
+      std::string value;
+      for (int i = 0; i < kPerThread; ++i) {
+        a.push(std::to_string(t * kPerThread + i));
+        if (i % 2 && a.try_pop(value)) popped[t].push_back(std::stoi(value));
+      }
+      while (a.try_pop(value)) popped[t].push_back(std::stoi(value));
+    });
+  }
+  std::thread reader([&a, &done] {
+    std::string value;
+    while (!done.load()) {
+      if (a.try_top(value)) {
+        ASSERT_FALSE(value.empty());
+      }
+    }
+  });
+  for (auto &thread : threads) thread.join();
+  done.store(true);
+  reader.join();
+
+  std::vector<int> seen(kThreads * kPerThread, 0);
+  for (const auto &items : popped) {
+    for (int value : items) ++seen[value];
+  }
+  for (int count : seen) ASSERT_EQ(count, 1);
+  ASSERT_TRUE(a.empty());
+}
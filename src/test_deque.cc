@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "my_deque.h"
+#include "my_queue.h"
+#include "my_stack.h"
+
+namespace {
+
+template <class T>
+void ExpectEqual(const mynamespace::Deque<T> &a, const std::deque<T> &b) {
+  ASSERT_EQ(a.size(), b.size());
+  ASSERT_EQ(a.empty(), b.empty());
+  for (size_t i = 0; i < b.size(); ++i) {
+    ASSERT_EQ(a[i], b[i]);
+  }
+  if (!b.empty()) {
+    ASSERT_EQ(a.front(), b.front());
+    ASSERT_EQ(a.back(), b.back());
+  }
+}
+
+}  // namespace
+
+TEST(test_deque, Constructors) {
+  mynamespace::Deque<int> a;
+  ASSERT_TRUE(a.empty());
+  mynamespace::Deque<std::string> b{"Misha", "Max", "Sasha"};
+  std::deque<std::string> c{"Misha", "Max", "Sasha"};
+  ExpectEqual(b, c);
+  mynamespace::Deque<std::string> d(b);
+  ExpectEqual(d, c);
+  mynamespace::Deque<std::string> e(std::move(b));
+  ASSERT_TRUE(b.empty());
+  ExpectEqual(e, c);
+  b = std::move(e);
+  ExpectEqual(b, c);
+  mynamespace::Deque<int> f(100);
+  ExpectEqual(f, std::deque<int>(100));
+}
+
+TEST(test_deque, PushPopBothEnds) {
+  mynamespace::Deque<int> a;
+  std::deque<int> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  ExpectEqual(a, b);
+  for (int i = 0; i < 700; ++i) {
+    a.pop_front();
+    b.pop_front();
+    a.pop_back();
+    b.pop_back();
+  }
+  ExpectEqual(a, b);
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  a.push_front(5);
+  ASSERT_EQ(a.back(), 5);
+}
+
+TEST(test_deque, RandomOperations) {
+  mynamespace::Deque<std::string> a;
+  std::deque<std::string> b;
+  std::mt19937 gen(3);
+  for (int step = 0; step < 20000; ++step) {
+    std::string value = std::to_string(step);
+    switch (gen() % 4) {
+      case 0:
+        a.push_back(value);
+        b.push_back(value);
+        break;
+      case 1:
+        a.push_front(value);
+        b.push_front(value);
+        break;
+      case 2:
+        if (!b.empty()) {
+          a.pop_back();
+          b.pop_back();
+        }
+        break;
+      default:
+        if (!b.empty()) {
+          a.pop_front();
+          b.pop_front();
+        }
+        break;
+    }
+  }
+  ExpectEqual(a, b);
+}
+
+TEST(test_deque, RandomAccessIterators) {
+  mynamespace::Deque<int> a;
+  for (int i = 0; i < 500; ++i) a.push_front(i);
+  auto first = a.begin();
+  auto last = a.end();
+  ASSERT_EQ(last - first, 500);
+  ASSERT_EQ(first[10], 489);
+  ASSERT_EQ(*(first + 499), 0);
+  ASSERT_TRUE(first < last);
+  std::sort(a.begin(), a.end());
+  for (int i = 0; i < 500; ++i) ASSERT_EQ(a[i], i);
+  ASSERT_EQ(std::distance(a.cbegin(), a.cend()), 500);
+  auto it = a.cend();
+  --it;
+  ASSERT_EQ(*it, 499);
+  ASSERT_EQ(a.at(3), 3);
+  ASSERT_THROW(a.at(500), std::out_of_range);
+}
+
+TEST(test_deque, IteratorOperations) {
+  mynamespace::Deque<std::pair<int, int>> a;
+  for (int i = 0; i < 10; ++i) a.push_back({i, -i});
+  auto it = a.begin();
+  ASSERT_EQ((it++)->first, 0);
+  ASSERT_EQ(it->first, 1);
+  ASSERT_EQ((it--)->second, -1);
+  ASSERT_EQ(it, a.begin());
+  ASSERT_EQ((2 + a.begin())->first, 2);
+  it->second = 42;
+  ASSERT_EQ(a.front().second, 42);
+  auto cit = 3 + a.cbegin();
+  using ConstRef = const std::pair<int, int> &;
+  static_assert(std::is_same<decltype(cit), decltype(a.cbegin())>::value &&
+                    std::is_same<decltype(*(cit++)), ConstRef>::value &&
+                    std::is_same<decltype(*(cit + 1)), ConstRef>::value,
+                "const iterator arithmetic must stay const");
+  ASSERT_EQ(cit->first, 3);
+  ASSERT_EQ((cit++)->first, 3);
+  ASSERT_EQ(a.cend() - cit, 6);
+  ASSERT_EQ((cit - 4)->first, 0);
+}
+
+TEST(test_deque, InsertMany) {
+  mynamespace::Deque<int> a{4, 5};
+  std::deque<int> b{1, 2, 3, 4, 5, 6, 7};
+  a.insert_many_front(1, 2, 3);
+  a.insert_many_back(6, 7);
+  ExpectEqual(a, b);
+}
+
+TEST(test_deque, Backend) {
+  mynamespace::Queue<int> a;
+  mynamespace::Stack<int, mynamespace::Deque<int>> b;
+  for (int i = 0; i < 10000; ++i) {
+    a.push(i);
+    b.push(i);
+  }
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(a.front(), i);
+    ASSERT_EQ(b.top(), 9999 - i);
+    a.pop();
+    b.pop();
+  }
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(b.empty());
+}
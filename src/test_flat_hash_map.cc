@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "my_flat_hash_map.h"
+
+namespace {
+
+// Hashes every string-like type the same way, so lookups by
+// std::string_view or C string need no std::string temporary.
+struct StringHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+
+  bool operator()(std::string_view a, std::string_view b) const {
+    return a == b;
+  }
+};
+
+template <class Map>
+std::vector<std::pair<int, int>> Sorted(const Map &m) {
+  std::vector<std::pair<int, int>> items(m.begin(), m.end());
+  std::sort(items.begin(), items.end());
+  return items;
+}
+
+}  // namespace
+
+TEST(test_flat_hash_map, AccessAndInsert) {
+  mynamespace::FlatHashMap<std::string, int> ages{{"Misha", 20}, {"Max", 30}};
+  ASSERT_EQ(ages.size(), 2U);
+  ASSERT_EQ(ages.at("Max"), 30);
+  ASSERT_THROW(ages.at("Sasha"), std::out_of_range);
+  ages["Sasha"] = 25;
+  ASSERT_EQ(ages.at("Sasha"), 25);
+  ASSERT_EQ(ages["Pasha"], 0);
+  ASSERT_EQ(ages.size(), 4U);
+  ASSERT_FALSE(ages.insert("Max", 31).second);
+  ASSERT_EQ(ages["Max"], 30);
+  ASSERT_FALSE(ages.insert_or_assign("Max", 31).second);
+  ASSERT_EQ(ages["Max"], 31);
+  auto [it, inserted] = ages.insert({"Dasha", 40});
+  ASSERT_TRUE(inserted);
+  ASSERT_EQ(it->first, "Dasha");
+  it->second = 41;
+  ASSERT_EQ(ages.at("Dasha"), 41);
+  ASSERT_TRUE(ages.emplace("Grisha", 50).second);
+  ASSERT_FALSE(ages.emplace("Grisha", 51).second);
+  const auto &view = ages;
+  ASSERT_EQ(view.at("Grisha"), 50);
+  ASSERT_TRUE(view.contains("Misha"));
+  ASSERT_EQ(view.count("Nobody"), 0U);
+  int total = 0;
+  for (const auto &[name, age] : view) total += age;
+  ASSERT_EQ(total, 20 + 31 + 25 + 0 + 41 + 50);
+  ASSERT_EQ(ages.erase("Pasha"), 1U);
+  ASSERT_EQ(ages.erase("Pasha"), 0U);
+  ASSERT_EQ(ages.find("Pasha"), ages.end());
+}
+
+TEST(test_flat_hash_map, MatchesStdUnderChurn) {
+  std::mt19937 gen(11);
+  mynamespace::FlatHashMap<int, int> a;
+  std::unordered_map<int, int> b;
+  for (int round = 0; round < 200000; ++round) {
+    int key = static_cast<int>(gen() % 5000);
+    switch (gen() % 4) {
+      case 0:
+        ASSERT_EQ(a.erase(key), b.erase(key));
+        break;
+      case 1: {
+        auto it = a.find(key);
+        ASSERT_EQ(it == a.end(), b.find(key) == b.end());
+        if (it != a.end()) {
+          ASSERT_EQ(it->second, b[key]);
+          a.erase(it);
+          b.erase(key);
+        }
+        break;
+      }
+      default:
+        a[key] += round;
+        b[key] += round;
+    }
+    ASSERT_EQ(a.size(), b.size());
+  }
+  ASSERT_LE(a.load_factor(), a.max_load_factor());
+  std::vector<std::pair<int, int>> expected(b.begin(), b.end());
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(Sorted(a), expected);
+}
+
+TEST(test_flat_hash_map, HeterogeneousLookup) {
+  mynamespace::FlatHashMap<std::string, int, StringHash, StringEqual> ids;
+  ids["alpha"] = 1;
+  ids["beta"] = 2;
+  std::string_view beta = "beta";
+  ASSERT_EQ(ids.find(beta)->second, 2);
+  ASSERT_TRUE(ids.contains("alpha"));
+  ASSERT_EQ(ids.count(std::string_view("gamma")), 0U);
+  const auto &view = ids;
+  ASSERT_EQ(view.find("alpha")->second, 1);
+  ASSERT_EQ(view.find(std::string_view("delta")), view.end());
+}
+
+TEST(test_flat_hash_map, ReserveAndRehash) {
+  mynamespace::FlatHashMap<int, int> a;
+  ASSERT_EQ(a.bucket_count(), 0U);
+  ASSERT_EQ(a.begin(), a.end());
+  a.reserve(1000);
+  size_t buckets = a.bucket_count();
+  ASSERT_GE(buckets * 7 / 8, 1000U);
+  auto first = a.insert(0, 0).first;
+  for (int i = 1; i < 1000; ++i) a[i] = i;
+  ASSERT_EQ(a.bucket_count(), buckets);
+  ASSERT_EQ(first->first, 0);
+  for (int i = 0; i < 990; ++i) a.erase(i);
+  a.rehash(0);
+  ASSERT_EQ(a.bucket_count(), 16U);
+  ASSERT_EQ(Sorted(a).front(), std::make_pair(990, 990));
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.begin(), a.end());
+  a.rehash(0);
+  ASSERT_EQ(a.bucket_count(), 0U);
+  mynamespace::FlatHashMap<int, int> b(100);
+  ASSERT_EQ(b.bucket_count(), 128U);
+}
+
+TEST(test_flat_hash_map, CopyMoveSwapMergeInsertMany) {
+  mynamespace::FlatHashMap<int, std::string> a{{1, "one"}, {2, "two"}};
+  mynamespace::FlatHashMap<int, std::string> b{{2, "deux"}, {3, "trois"}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a[2], "two");
+  ASSERT_EQ(b.size(), 1U);
+  ASSERT_EQ(b[2], "deux");
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1U);
+  mynamespace::FlatHashMap<int, std::string> c(std::move(b));
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(c.size(), 3U);
+  mynamespace::FlatHashMap<int, std::string> d(c);
+  d[1] = "uno";
+  ASSERT_EQ(c[1], "one");
+  auto result = d.insert_many(std::make_pair(4, std::string("four")),
+                              std::make_pair(1, std::string("eins")));
+  ASSERT_TRUE(result[0].second);
+  ASSERT_FALSE(result[1].second);
+  ASSERT_EQ(result[0].first->second, "four");
+  ASSERT_EQ(result[1].first->second, "uno");
+  b = std::move(d);
+  ASSERT_EQ(b.size(), 4U);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "my_flat_hash_set.h"
+
+namespace {
+
+// Sends every key to one of four hashes, so long probe sequences, full
+// groups and tombstones all occur with a few hundred keys.
+struct CollidingHash {
+  size_t operator()(int key) const { return static_cast<size_t>(key % 4); }
+};
+
+// Over-aligned, to check the slots after the control bytes are aligned.
+struct alignas(64) Wide {
+  Wide(int key = 0) : key(key), name(std::to_string(key)) {}
+
+  bool operator==(const Wide &other) const { return key == other.key; }
+
+  int key;
+  std::string name;
+};
+
+struct WideHash {
+  size_t operator()(const Wide &wide) const {
+    return std::hash<int>()(wide.key);
+  }
+};
+
+template <class Set>
+std::vector<int> Sorted(const Set &s) {
+  std::vector<int> keys(s.begin(), s.end());
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+}  // namespace
+
+TEST(test_flat_hash_set, InsertFindErase) {
+  mynamespace::FlatHashSet<std::string> a{"Misha", "Max", "Sasha", "Max"};
+  ASSERT_EQ(a.size(), 3U);
+  auto [it, inserted] = a.insert("Dasha");
+  ASSERT_TRUE(inserted);
+  ASSERT_EQ(*it, "Dasha");
+  ASSERT_FALSE(a.insert("Max").second);
+  ASSERT_TRUE(a.contains("Sasha"));
+  ASSERT_FALSE(a.contains("Pasha"));
+  ASSERT_EQ(a.find("Pasha"), a.end());
+  ASSERT_EQ(*a.find("Misha"), "Misha");
+  ASSERT_EQ(*a.emplace(3, 'x').first, "xxx");
+  ASSERT_EQ(a.erase("Max"), 1U);
+  ASSERT_EQ(a.erase("Max"), 0U);
+  ASSERT_EQ(std::distance(a.begin(), a.end()), 4);
+}
+
+TEST(test_flat_hash_set, MatchesStdWithCollisions) {
+  std::mt19937 gen(7);
+  mynamespace::FlatHashSet<int, CollidingHash> a;
+  std::unordered_set<int> b;
+  for (int round = 0; round < 20000; ++round) {
+    int key = static_cast<int>(gen() % 300);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(a.erase(key), b.erase(key));
+    } else {
+      ASSERT_EQ(a.insert(key).second, b.insert(key).second);
+    }
+    ASSERT_EQ(a.size(), b.size());
+    ASSERT_EQ(a.contains(key), b.count(key) == 1);
+  }
+  std::vector<int> expected(b.begin(), b.end());
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(Sorted(a), expected);
+  for (auto it = a.begin(); it != a.end();) {
+    it = *it % 2 ? a.erase(it) : std::next(it);
+  }
+  for (int key : a) ASSERT_EQ(key % 2, 0);
+  ASSERT_EQ(a.size(), static_cast<size_t>(std::count_if(
+                          expected.begin(), expected.end(),
+                          [](int key) { return key % 2 == 0; })));
+}
+
+TEST(test_flat_hash_set, OverAlignedElements) {
+  mynamespace::FlatHashSet<Wide, WideHash> a;
+  for (int i = 0; i < 500; ++i) a.insert(Wide(i));
+  for (const Wide &wide : a) {
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(&wide) % alignof(Wide), 0U);
+    ASSERT_EQ(wide.name, std::to_string(wide.key));
+  }
+  mynamespace::FlatHashSet<Wide, WideHash> copy(a);
+  for (int i = 0; i < 500; i += 2) copy.erase(Wide(i));
+  ASSERT_EQ(copy.size(), 250U);
+  ASSERT_EQ(a.size(), 500U);
+  ASSERT_EQ(copy.find(Wide(7))->name, "7");
+}
+
+TEST(test_flat_hash_set, MergeAndInsertMany) {
+  mynamespace::FlatHashSet<int> a{1, 2, 3};
+  mynamespace::FlatHashSet<int> b{3, 4};
+  a.merge(b);
+  ASSERT_EQ(Sorted(a), (std::vector<int>{1, 2, 3, 4}));
+  ASSERT_EQ(Sorted(b), (std::vector<int>{3}));
+  auto result = a.insert_many(5, 1, 6);
+  ASSERT_TRUE(result[0].second);
+  ASSERT_FALSE(result[1].second);
+  ASSERT_TRUE(result[2].second);
+  ASSERT_EQ(*result[0].first, 5);
+  ASSERT_EQ(*result[1].first, 1);
+  ASSERT_EQ(*result[2].first, 6);
+  mynamespace::FlatHashSet<int> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(c.size(), 6U);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "my_intrusive_list.h"
+#include "my_queue.h"
+#include "my_stack.h"
+
+namespace {
+
+struct Task {
+  explicit Task(int id, std::string name = "") : id(id), name(name) {}
+
+  bool operator<(const Task &other) const { return id < other.id; }
+  bool operator==(const Task &other) const { return id == other.id; }
+
+  int id;
+  std::string name;
+  mynamespace::IntrusiveListHook hook;
+  mynamespace::IntrusiveListHook ready_hook;
+};
+
+using TaskList = mynamespace::IntrusiveList<Task, &Task::hook>;
+using ReadyList = mynamespace::IntrusiveList<Task, &Task::ready_hook>;
+
+std::vector<int> Ids(const TaskList &list) {
+  std::vector<int> ids;
+  for (const Task &task : list) ids.push_back(task.id);
+  return ids;
+}
+
+}  // namespace
+
+TEST(test_intrusive_list, LinksObjectsInPlace) {
+  Task a(1, "Misha"), b(2, "Max"), c(3, "Sasha");
+  TaskList list;
+  ASSERT_TRUE(list.empty());
+  list.push_back(b);
+  list.push_front(a);
+  list.push_back(c);
+  ASSERT_EQ(list.size(), 3U);
+  ASSERT_EQ(&list.front(), &a);
+  ASSERT_EQ(&list.back(), &c);
+  ASSERT_EQ(list.begin()->name, "Misha");
+  list.front().name = "Misha2";
+  ASSERT_EQ(a.name, "Misha2");
+  ASSERT_TRUE(b.hook.is_linked());
+  ASSERT_THROW(list.push_back(b), std::invalid_argument);
+  list.clear();
+  ASSERT_FALSE(b.hook.is_linked());
+}
+
+TEST(test_intrusive_list, EraseByReference) {
+  Task a(1), b(2), c(3);
+  TaskList list;
+  list.insert_many_back(a, b, c);
+  list.erase(b);
+  ASSERT_FALSE(b.hook.is_linked());
+  ASSERT_EQ(Ids(list), (std::vector<int>{1, 3}));
+  auto it = list.erase(list.iterator_to(a));
+  ASSERT_EQ(&*it, &c);
+  list.pop_back();
+  ASSERT_TRUE(list.empty());
+  list.push_back(b);
+  ASSERT_EQ(list.size(), 1U);
+}
+
+TEST(test_intrusive_list, TwoHooksTwoLists) {
+  Task a(1), b(2);
+  TaskList all;
+  ReadyList ready;
+  all.insert_many_back(a, b);
+  ready.push_back(b);
+  ASSERT_EQ(all.size(), 2U);
+  ASSERT_EQ(&ready.front(), &b);
+  all.erase(b);
+  ASSERT_EQ(&ready.front(), &b);
+}
+
+TEST(test_intrusive_list, SortMergeUnique) {
+  std::vector<Task> tasks;
+  for (int id : {5, 1, 4, 1, 3, 9, 2, 6}) tasks.emplace_back(id);
+  TaskList a;
+  for (Task &task : tasks) a.push_back(task);
+  a.sort();
+  ASSERT_EQ(Ids(a), (std::vector<int>{1, 1, 2, 3, 4, 5, 6, 9}));
+  ASSERT_EQ(&a.front(), &tasks[1]);
+  a.unique();
+  ASSERT_EQ(Ids(a), (std::vector<int>{1, 2, 3, 4, 5, 6, 9}));
+  ASSERT_FALSE(tasks[3].hook.is_linked());
+
+  Task x(0), y(7), z(10);
+  TaskList b;
+  b.insert_many_back(x, y, z);
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(Ids(a), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 9, 10}));
+  a.sort([](const Task &l, const Task &r) { return r < l; });
+  ASSERT_EQ(a.front().id, 10);
+  ASSERT_EQ(a.back().id, 0);
+  a.clear();
+}
+
+TEST(test_intrusive_list, SpliceAndReverse) {
+  Task a(1), b(2), c(3), d(4);
+  TaskList l1, l2;
+  l1.insert_many_back(a, b);
+  l2.insert_many_back(c, d);
+  l1.splice(l1.cend(), l2, l2.cbegin());
+  ASSERT_EQ(Ids(l1), (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(l2.size(), 1U);
+  l1.splice(l1.cbegin(), l2);
+  ASSERT_EQ(Ids(l1), (std::vector<int>{4, 1, 2, 3}));
+  ASSERT_TRUE(l2.empty());
+  l2.splice(l2.cend(), l1, ++l1.cbegin(), l1.cend());
+  ASSERT_EQ(Ids(l2), (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(l1.size(), 1U);
+  l2.reverse();
+  ASSERT_EQ(Ids(l2), (std::vector<int>{3, 2, 1}));
+  ASSERT_EQ((--l2.end())->id, 1);
+  TaskList l3(std::move(l2));
+  ASSERT_EQ(Ids(l3), (std::vector<int>{3, 2, 1}));
+  ASSERT_TRUE(l2.empty());
+  l3.swap(l1);
+  ASSERT_EQ(Ids(l1), (std::vector<int>{3, 2, 1}));
+  ASSERT_EQ(Ids(l3), (std::vector<int>{4}));
+}
+
+TEST(test_intrusive_list, AdapterBackend) {
+  Task a(1), b(2), c(3);
+  mynamespace::Queue<Task, TaskList> queue;
+  queue.push(a);
+  queue.insert_many_back(b, c);
+  ASSERT_EQ(queue.size(), 3U);
+  ASSERT_EQ(&queue.front(), &a);
+  queue.pop();
+  ASSERT_FALSE(a.hook.is_linked());
+  ASSERT_EQ(&queue.front(), &b);
+
+  Task d(4), e(5);
+  mynamespace::Stack<Task, ReadyList> stack;
+  stack.push(d);
+  stack.push(e);
+  ASSERT_EQ(&stack.top(), &e);
+  stack.pop();
+  ASSERT_EQ(&stack.top(), &d);
+}
@@ -1,8 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 #include "my_list.h"
+#include "test_values.h"
 
 TEST(test_list, DefaultConstructor) {
   mynamespace::List<int> a;
@@ -256,3 +265,403 @@ TEST(test_list, InsertManyFront) {
     ASSERT_EQ(*it1, *it2);
   }
 }
+
+TEST(test_list, Sort) {
+  mynamespace::List<int> a{5, 3, 8, 1, 9, 2, 7, 3, 0};
+  std::list<int> b{5, 3, 8, 1, 9, 2, 7, 3, 0};
+  a.sort();
+  b.sort();
+  ASSERT_EQ(a.size(), b.size());
+  auto it1 = a.begin();
+  auto it2 = b.begin();
+  for (; it2 != b.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+  auto it3 = a.end();
+  auto it4 = b.end();
+  for (--it3, --it4; it4 != b.begin(); --it3, --it4) {
+    ASSERT_EQ(*it3, *it4);
+  }
+}
+
+TEST(test_list, SortLarge) {
+  mynamespace::List<std::string> a;
+  std::list<std::string> b;
+  unsigned seed = 12345;
+  for (int i = 0; i < 10000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    a.push_back(std::to_string(seed % 1000));
+    b.push_back(std::to_string(seed % 1000));
+  }
+  a.sort();
+  b.sort();
+  ASSERT_EQ(a.size(), b.size());
+  auto it1 = a.begin();
+  auto it2 = b.begin();
+  for (; it2 != b.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+}
+
+TEST(test_list, SortComparatorStable) {
+  using Pair = std::pair<int, int>;
+  mynamespace::List<Pair> a{{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}, {3, 5}};
+  std::list<Pair> b{{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}, {3, 5}};
+  auto by_key = [](const Pair &x, const Pair &y) { return x.first > y.first; };
+  a.sort(by_key);
+  b.sort(by_key);
+  auto it1 = a.begin();
+  auto it2 = b.begin();
+  for (; it2 != b.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+}
+
+namespace {
+
+struct CopyCounter {
+  static int copies;
+  int value;
+  CopyCounter(int v = 0) : value(v) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  bool operator<(const CopyCounter &other) const { return value < other.value; }
+};
+
+int CopyCounter::copies = 0;
+
+}  // namespace
+
+TEST(test_list, SortRelinksNodes) {
+  mynamespace::List<CopyCounter> a{4, 2, 5, 1, 3};
+  const CopyCounter *smallest = &*(++++++a.begin());
+  CopyCounter::copies = 0;
+  a.sort();
+  ASSERT_EQ(CopyCounter::copies, 0);
+  ASSERT_EQ(&*a.begin(), smallest);
+  int expected = 1;
+  for (auto it = a.begin(); it != a.end(); ++it, ++expected) {
+    ASSERT_EQ((*it).value, expected);
+  }
+}
+
+namespace {
+
+// Sorts values long enough to take the radix path and checks the order
+// against std::list and that every node was relinked rather than copied.
+template <class T>
+void ExpectRadixSorted(const std::vector<T> &values) {
+  mynamespace::List<T> a(values.begin(), values.end());
+  std::list<T> b(values.begin(), values.end());
+  std::vector<const T *> nodes;
+  for (const T &value : a) nodes.push_back(&value);
+  a.sort();
+  b.sort();
+  ASSERT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+  std::vector<const T *> sorted_nodes;
+  for (const T &value : a) sorted_nodes.push_back(&value);
+  std::sort(nodes.begin(), nodes.end());
+  std::sort(sorted_nodes.begin(), sorted_nodes.end());
+  ASSERT_EQ(nodes, sorted_nodes);
+  auto it = a.end();
+  for (auto expected = b.rbegin(); expected != b.rend(); ++expected) {
+    ASSERT_EQ(*--it, *expected);
+  }
+}
+
+}  // namespace
+
+TEST(test_list, SortRadixIntegers) {
+  std::mt19937_64 gen(17);
+  std::vector<int> ints{std::numeric_limits<int>::min(), -1, 0,
+                        std::numeric_limits<int>::max()};
+  std::vector<int8_t> bytes;
+  std::vector<uint64_t> wide{0, std::numeric_limits<uint64_t>::max()};
+  for (int i = 0; i < 5000; ++i) {
+    ints.push_back(static_cast<int>(gen()));
+    ints.push_back(static_cast<int>(gen() % 100) - 50);
+    bytes.push_back(static_cast<int8_t>(gen()));
+    wide.push_back(gen() >> (gen() % 64));
+  }
+  ExpectRadixSorted(ints);
+  ExpectRadixSorted(bytes);
+  ExpectRadixSorted(wide);
+}
+
+TEST(test_list, SortRadixFloatingPoint) {
+  std::mt19937 gen(19);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> doubles{-std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::denorm_min(),
+                              -std::numeric_limits<double>::denorm_min()};
+  std::vector<float> floats;
+  for (int i = 0; i < 5000; ++i) {
+    doubles.push_back(dist(gen));
+    floats.push_back(static_cast<float>(dist(gen)) / 1024);
+  }
+  ExpectRadixSorted(doubles);
+  ExpectRadixSorted(floats);
+}
+
+TEST(test_list, SortRadixKeepsEqualZerosInOrder) {
+  mynamespace::List<double> a;
+  for (int i = 0; i < 200; ++i) a.push_back(i % 3 == 0 ? -0.0 : 0.0);
+  for (int i = 0; i < 200; ++i) a.push_back(i - 100.5);
+  a.sort();
+  std::vector<bool> signs;
+  for (double value : a) {
+    if (value == 0) signs.push_back(std::signbit(value));
+  }
+  ASSERT_EQ(signs.size(), 200U);
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(signs[i], i % 3 == 0);
+}
+
+TEST(test_list, MergeInterleaved) {
+  mynamespace::List<int> a{1, 3, 3, 5, 9};
+  mynamespace::List<int> b{0, 2, 3, 6, 10, 11};
+  std::list<int> c{1, 3, 3, 5, 9};
+  std::list<int> d{0, 2, 3, 6, 10, 11};
+  const int *node = &*b.begin();
+  a.merge(b);
+  c.merge(d);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), c.size());
+  ASSERT_EQ(&*a.begin(), node);
+  auto it1 = a.begin();
+  auto it2 = c.begin();
+  for (; it2 != c.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+  ASSERT_EQ(a.back(), 11);
+}
+
+TEST(test_list, MergeComparator) {
+  mynamespace::List<int> a{9, 5, 1};
+  mynamespace::List<int> b{8, 4, 2};
+  std::list<int> c{9, 5, 1};
+  std::list<int> d{8, 4, 2};
+  a.merge(b, std::greater<int>());
+  c.merge(d, std::greater<int>());
+  auto it1 = a.begin();
+  auto it2 = c.begin();
+  for (; it2 != c.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+}
+
+TEST(test_list, MergeEmpty) {
+  mynamespace::List<int> a;
+  mynamespace::List<int> b{1, 2};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 2U);
+  ASSERT_EQ(a.front(), 1);
+  ASSERT_EQ(a.back(), 2);
+  a.merge(b);
+  ASSERT_EQ(a.size(), 2U);
+}
+
+TEST(test_list, SpliceKeepsNodes) {
+  mynamespace::List<int> a{1, 2};
+  mynamespace::List<int> b{5, 6};
+  const int *node = &*b.begin();
+  auto pos = a.cbegin();
+  ++pos;
+  a.splice(pos, b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), 4U);
+  auto it = a.begin();
+  ++it;
+  ASSERT_EQ(&*it, node);
+  std::list<int> c{1, 5, 6, 2};
+  auto it2 = c.begin();
+  for (it = a.begin(); it2 != c.end(); ++it, ++it2) {
+    ASSERT_EQ(*it, *it2);
+  }
+}
+
+TEST(test_list, SpliceElement) {
+  mynamespace::List<int> a{1, 2, 3};
+  mynamespace::List<int> b{4, 5, 6};
+  std::list<int> c{1, 2, 3};
+  std::list<int> d{4, 5, 6};
+  auto it1 = b.cbegin();
+  ++it1;
+  auto it2 = d.cbegin();
+  ++it2;
+  a.splice(a.cend(), b, it1);
+  c.splice(c.cend(), d, it2);
+  auto it3 = a.cend();
+  --it3;
+  a.splice(a.cbegin(), a, it3);
+  c.splice(c.cbegin(), c, --c.cend());
+  ASSERT_EQ(a.size(), c.size());
+  ASSERT_EQ(b.size(), d.size());
+  auto it4 = a.begin();
+  auto it5 = c.begin();
+  for (; it5 != c.end(); ++it4, ++it5) {
+    ASSERT_EQ(*it4, *it5);
+  }
+  ASSERT_EQ(b.front(), 4);
+  ASSERT_EQ(b.back(), 6);
+}
+
+TEST(test_list, SpliceRange) {
+  mynamespace::List<int> a{1, 2, 3};
+  mynamespace::List<int> b{4, 5, 6, 7};
+  std::list<int> c{1, 2, 3};
+  std::list<int> d{4, 5, 6, 7};
+  auto pos = a.cbegin();
+  auto first = b.cbegin();
+  auto last = b.cend();
+  ++pos;
+  ++first;
+  --last;
+  a.splice(pos, b, first, last);
+  c.splice(++c.cbegin(), d, ++d.cbegin(), --d.cend());
+  auto middle = a.cbegin();
+  ++middle;
+  ++middle;
+  a.splice(a.cbegin(), a, middle, a.cend());
+  c.splice(c.cbegin(), c, ++++c.cbegin(), c.cend());
+  ASSERT_EQ(a.size(), c.size());
+  ASSERT_EQ(b.size(), d.size());
+  auto it1 = a.begin();
+  auto it2 = c.begin();
+  for (; it2 != c.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+  auto it3 = b.begin();
+  auto it4 = d.begin();
+  for (; it4 != d.end(); ++it3, ++it4) {
+    ASSERT_EQ(*it3, *it4);
+  }
+}
+
+TEST(test_list, PushBackMove) {
+  mynamespace::List<Message> a;
+  Message m("payload", 1);
+  Message::reset();
+  a.push_back(std::move(m));
+  a.push_front(Message("head", 0));
+  a.insert(a.end(), Message("tail", 2));
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(Message::moves, 3);
+  ASSERT_EQ(a.front().id, 0);
+  ASSERT_EQ(a.back().body, "tail");
+  ASSERT_EQ((*++a.begin()).body, "payload");
+}
+
+TEST(test_list, Emplace) {
+  mynamespace::List<Message> a;
+  Message::reset();
+  Message &back = a.emplace_back("b", 2);
+  Message &front = a.emplace_front("a", 1);
+  auto it = a.emplace(a.cend(), "c", 3);
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(Message::moves, 0);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(&front, &a.front());
+  ASSERT_EQ(&back, &*++a.begin());
+  ASSERT_EQ((*it).id, 3);
+  ASSERT_EQ(a.back().body, "c");
+}
+
+TEST(test_list, InsertManyForwards) {
+  mynamespace::List<Message> a;
+  a.emplace_back("last", 9);
+  Message m1("one", 1);
+  Message m2("two", 2);
+  Message::reset();
+  a.insert_many(a.cbegin(), std::move(m1), std::move(m2));
+  a.insert_many_back(Message("back", 10));
+  a.insert_many_front(Message("front", 0));
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(Message::moves, 4);
+  Message m3("copied", 3);
+  a.insert_many_back(m3);
+  ASSERT_EQ(Message::copies, 1);
+  int ids[] = {0, 1, 2, 9, 10, 3};
+  auto it = a.begin();
+  for (int id : ids) {
+    ASSERT_EQ((*it).id, id);
+    ++it;
+  }
+}
+
+TEST(test_list, RangeConstructors) {
+  std::vector<Message> source;
+  for (int i = 0; i < 4; ++i) source.emplace_back("m", i);
+  Message::reset();
+  mynamespace::List<Message> a(source.begin(), source.end());
+  ASSERT_EQ(Message::copies, 4);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(a.back().id, 3);
+  Message::reset();
+  mynamespace::List<Message> b(a);
+  ASSERT_EQ(Message::copies, 4);
+  ASSERT_TRUE(std::equal(b.cbegin(), b.cend(), source.begin(),
+                         [](const Message &l, const Message &r) {
+                           return l.id == r.id;
+                         }));
+  mynamespace::List<int> c(3, 7);
+  std::list<int> d(3, 7);
+  ASSERT_TRUE(std::equal(c.cbegin(), c.cend(), d.begin(), d.end()));
+  mynamespace::List<int> e(d.begin(), d.end());
+  ASSERT_EQ(e.size(), 3U);
+  mynamespace::List<int> f(c.begin(), c.end());
+  ASSERT_EQ(std::distance(f.begin(), f.end()), 3);
+}
+
+TEST(test_list, InsertRange) {
+  mynamespace::List<int> a{1, 5};
+  int middle[] = {2, 3, 4};
+  auto it = a.insert(++a.cbegin(), std::begin(middle), std::end(middle));
+  ASSERT_EQ(*it, 2);
+  auto first = a.insert(a.cend(), 2, 6);
+  ASSERT_EQ(*first, 6);
+  std::list<int> expected{1, 2, 3, 4, 5, 6, 6};
+  ASSERT_EQ(a.size(), expected.size());
+  ASSERT_TRUE(std::equal(a.cbegin(), a.cend(), expected.begin()));
+  auto none = a.insert(a.cbegin(), middle, middle);
+  ASSERT_EQ(none, a.cbegin());
+  ASSERT_EQ(a.size(), expected.size());
+}
+
+TEST(test_list, AssignReusesNodes) {
+  mynamespace::List<int> a{1, 2, 3, 4};
+  const int *second = &*++a.cbegin();
+  int shorter[] = {7, 8};
+  a.assign(std::begin(shorter), std::end(shorter));
+  ASSERT_EQ(a.size(), 2U);
+  ASSERT_EQ(&*++a.cbegin(), second);
+  ASSERT_EQ(a.back(), 8);
+  std::list<int> longer{1, 2, 3, 4, 5};
+  a.assign(longer.begin(), longer.end());
+  ASSERT_TRUE(std::equal(a.cbegin(), a.cend(), longer.begin(), longer.end()));
+  a.assign(3, 9);
+  std::list<int> nines(3, 9);
+  ASSERT_TRUE(std::equal(a.cbegin(), a.cend(), nines.begin(), nines.end()));
+}
+
+TEST(test_list, InsertRangeIsAllOrNothing) {
+  struct Fragile {
+    explicit Fragile(int v) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy");
+    }
+    int value;
+  };
+  mynamespace::List<Fragile> a;
+  a.emplace_back(1);
+  std::vector<Fragile> source;
+  for (int v : {2, 3, -1, 4}) source.emplace_back(v);
+  ASSERT_THROW(a.insert(a.cend(), source.begin(), source.end()),
+               std::runtime_error);
+  ASSERT_EQ(a.size(), 1U);
+  ASSERT_EQ(a.back().value, 1);
+}
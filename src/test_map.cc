@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "my_map.h"
+
+TEST(test_map, AccessAndInsert) {
+  mynamespace::Map<std::string, int> ages{{"Misha", 20}, {"Max", 30}};
+  ASSERT_EQ(ages.size(), 2U);
+  ASSERT_EQ(ages.at("Max"), 30);
+  ASSERT_THROW(ages.at("Sasha"), std::out_of_range);
+  ages["Sasha"] = 25;
+  ASSERT_EQ(ages.at("Sasha"), 25);
+  ASSERT_EQ(ages["Pasha"], 0);
+  ASSERT_EQ(ages.size(), 4U);
+  ASSERT_FALSE(ages.insert("Max", 31).second);
+  ASSERT_EQ(ages["Max"], 30);
+  ASSERT_FALSE(ages.insert_or_assign("Max", 31).second);
+  ASSERT_EQ(ages["Max"], 31);
+  auto [it, inserted] = ages.insert({"Dasha", 40});
+  ASSERT_TRUE(inserted);
+  ASSERT_EQ(it->first, "Dasha");
+  it->second = 41;
+  ASSERT_EQ(ages.at("Dasha"), 41);
+  ASSERT_TRUE(ages.emplace("Grisha", 50).second);
+  const auto &view = ages;
+  ASSERT_EQ(view.at("Grisha"), 50);
+  ASSERT_TRUE(view.contains("Misha"));
+  std::vector<std::string> names;
+  for (const auto &[name, age] : view) names.push_back(name);
+  ASSERT_EQ(names, (std::vector<std::string>{"Dasha", "Grisha", "Max",
+                                             "Misha", "Pasha", "Sasha"}));
+}
+
+TEST(test_map, MatchesStdUnderChurn) {
+  std::mt19937 gen(9);
+  mynamespace::Map<int, std::string> a;
+  std::map<int, std::string> b;
+  for (int round = 0; round < 20000; ++round) {
+    int key = static_cast<int>(gen() % 2000);
+    switch (gen() % 4) {
+      case 0:
+        ASSERT_EQ(a.erase(key), b.erase(key));
+        break;
+      case 1: {
+        auto it = a.lower_bound(key);
+        auto expected = b.lower_bound(key);
+        ASSERT_EQ(it == a.end(), expected == b.end());
+        if (it != a.end()) {
+          ASSERT_EQ(it->first, expected->first);
+          it = a.erase(it);
+          expected = b.erase(expected);
+          ASSERT_EQ(it == a.end(), expected == b.end());
+          if (it != a.end()) {
+            ASSERT_EQ(it->first, expected->first);
+          }
+        }
+        break;
+      }
+      default:
+        a[key] += "x";
+        b[key] += "x";
+    }
+    ASSERT_EQ(a.size(), b.size());
+  }
+  auto expected = b.begin();
+  for (const auto &[key, value] : a) {
+    ASSERT_EQ(key, expected->first);
+    ASSERT_EQ(value, expected->second);
+    ++expected;
+  }
+}
+
+TEST(test_map, MoveSwapMergeInsertMany) {
+  mynamespace::Map<int, int> a{{1, 10}, {2, 20}};
+  mynamespace::Map<int, int> b{{2, 200}, {3, 300}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a[2], 20);
+  ASSERT_EQ(b.size(), 1U);
+  ASSERT_EQ(b[2], 200);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1U);
+  mynamespace::Map<int, int> c(std::move(b));
+  ASSERT_EQ(c.size(), 3U);
+  mynamespace::Map<int, int> d(c);
+  d[1] = 11;
+  ASSERT_EQ(c[1], 10);
+  auto result = d.insert_many(std::make_pair(4, 40), std::make_pair(1, 0));
+  ASSERT_TRUE(result[0].second);
+  ASSERT_FALSE(result[1].second);
+  ASSERT_EQ(result[0].first->second, 40);
+  ASSERT_EQ(result[1].first->second, 11);
+  ASSERT_EQ(d.count(4), 1U);
+}
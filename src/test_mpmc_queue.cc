@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "my_mpmc_queue.h"
+
+TEST(test_mpmc_queue, SingleThread) {
+  mynamespace::MpmcQueue<std::string> a(3);
+  ASSERT_EQ(a.capacity(), 3U);
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(a.try_push("Misha"));
+  std::string max = "Max";
+  ASSERT_TRUE(a.try_push(max));
+  ASSERT_TRUE(a.try_emplace(3, 'x'));
+  ASSERT_FALSE(a.try_push("Sasha"));
+  ASSERT_EQ(a.size(), 3U);
+  std::string value;
+  for (const char *expected : {"Misha", "Max", "xxx"}) {
+    ASSERT_TRUE(a.try_pop(value));
+    ASSERT_EQ(value, expected);
+  }
+  ASSERT_FALSE(a.try_pop(value));
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_mpmc_queue, ExactCapacity) {
+  for (size_t capacity : {0, 1, 4, 5}) {
+    mynamespace::MpmcQueue<int> a(capacity);
+    ASSERT_EQ(a.capacity(), capacity);
+    for (int round = 0; round < 3; ++round) {
+      for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(a.try_push(static_cast<int>(i)));
+      }
+      ASSERT_FALSE(a.try_push(-1));
+      ASSERT_EQ(a.size(), capacity);
+      int value;
+      for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(a.try_pop(value));
+        ASSERT_EQ(value, static_cast<int>(i));
+      }
+      ASSERT_FALSE(a.try_pop(value));
+    }
+  }
+}
+
+TEST(test_mpmc_queue, WrapAroundAndDestroy) {
+  auto item = std::make_shared<int>(1);
+  {
+    mynamespace::MpmcQueue<std::shared_ptr<int>> a(2);
+    std::shared_ptr<int> value;
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_TRUE(a.try_push(item));
+      ASSERT_TRUE(a.try_pop(value));
+    }
+    value.reset();
+    ASSERT_TRUE(a.try_push(item));
+    ASSERT_EQ(item.use_count(), 2);
+  }
+  ASSERT_EQ(item.use_count(), 1);
+}
+
+// Every item is delivered exactly once and each consumer sees the items of
+// one producer in the order they were pushed.
+TEST(test_mpmc_queue, ManyThreadStress) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 50000;
+  mynamespace::MpmcQueue<int> a(128);
+  std::vector<std::vector<int>> received(kConsumers);
+  std::atomic<int> remaining(kProducers * kPerProducer);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&a, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        while (!a.try_push(p * kPerProducer + i)) std::this_thread::yield();
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&a, &remaining, &received, c] {
+      int value;
+      while (remaining.load() > 0) {
+        if (a.try_pop(value)) {
+          received[c].push_back(value);
+          remaining.fetch_sub(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  std::vector<int> seen(kProducers * kPerProducer, 0);
+  for (const auto &items : received) {
+    std::vector<int> last(kProducers, -1);
+    for (int value : items) {
+      ++seen[value];
+      int producer = value / kPerProducer;
+      ASSERT_LT(last[producer], value);
+      last[producer] = value;
+    }
+  }
+  for (int count : seen) ASSERT_EQ(count, 1);
+  ASSERT_TRUE(a.empty());
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "my_multiset.h"
+
+namespace {
+
+// Ordered by key only, so equal keys can be told apart by tag.
+struct Tagged {
+  Tagged(int key = 0, int tag = 0) : key(key), tag(tag) {}
+
+  bool operator<(const Tagged &other) const { return key < other.key; }
+
+  int key;
+  int tag;
+  char padding[120];
+};
+
+template <class Container>
+std::vector<std::pair<int, int>> Items(const Container &c) {
+  std::vector<std::pair<int, int>> items;
+  for (const auto &item : c) items.emplace_back(item.key, item.tag);
+  return items;
+}
+
+}  // namespace
+
+TEST(test_multiset, KeepsDuplicatesInOrder) {
+  mynamespace::Multiset<int> a{3, 1, 3, 2, 3};
+  ASSERT_EQ(a.size(), 5U);
+  ASSERT_EQ(a.count(3), 3U);
+  ASSERT_EQ(a.count(4), 0U);
+  ASSERT_EQ(std::vector<int>(a.begin(), a.end()),
+            (std::vector<int>{1, 2, 3, 3, 3}));
+  auto range = a.equal_range(3);
+  ASSERT_EQ(std::distance(range.first, range.second), 3);
+  ASSERT_EQ(range.first, a.find(3));
+  ASSERT_EQ(range.second, a.end());
+  ASSERT_EQ(*a.lower_bound(2), 2);
+  ASSERT_EQ(*a.upper_bound(1), 2);
+  ASSERT_EQ(a.erase(3), 3U);
+  ASSERT_FALSE(a.contains(3));
+  ASSERT_EQ(*a.insert(0), 0);
+  ASSERT_EQ(*a.emplace(7), 7);
+  ASSERT_EQ(a.size(), 4U);
+}
+
+TEST(test_multiset, MatchesStdUnderChurn) {
+  std::mt19937 gen(5);
+  mynamespace::Multiset<Tagged> a;
+  std::multiset<Tagged> b;
+  for (int round = 0; round < 4000; ++round) {
+    int key = static_cast<int>(gen() % 100);
+    if (gen() % 3 == 0) {
+      auto it = a.find(key);
+      auto expected = b.find(key);
+      ASSERT_EQ(it == a.end(), expected == b.end());
+      if (it != a.end()) {
+        ASSERT_EQ(it->tag, expected->tag);
+        auto next = a.erase(it);
+        expected = b.erase(expected);
+        ASSERT_EQ(next == a.end(), expected == b.end());
+        if (next != a.end()) {
+          ASSERT_EQ(next->tag, expected->tag);
+        }
+      }
+    } else {
+      ASSERT_EQ(a.insert(Tagged(key, round))->tag, round);
+      b.insert(Tagged(key, round));
+    }
+    ASSERT_EQ(a.size(), b.size());
+  }
+  ASSERT_EQ(Items(a), Items(b));
+}
+
+TEST(test_multiset, MergeAndInsertMany) {
+  mynamespace::Multiset<std::string> a{"Max", "Misha"};
+  mynamespace::Multiset<std::string> b{"Max", "Sasha"};
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.count("Max"), 2U);
+  auto result = a.insert_many("Max", "Dasha", "Max");
+  ASSERT_EQ(result.size(), 3U);
+  ASSERT_EQ(a.count("Max"), 4U);
+  ASSERT_TRUE(result[0].second);
+  ASSERT_EQ(*result[1].first, "Dasha");
+  ASSERT_EQ(std::next(result[0].first), result[2].first);
+  ASSERT_EQ(std::next(result[2].first), a.find("Misha"));
+  mynamespace::Multiset<std::string> c(a);
+  ASSERT_EQ(std::vector<std::string>(c.begin(), c.end()),
+            std::vector<std::string>(a.begin(), a.end()));
+}
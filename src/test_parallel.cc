@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "my_deque.h"
+#include "my_list.h"
+#include "my_parallel.h"
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_thread_pool.h"
+#include "my_vector.h"
+
+namespace {
+
+// Four workers whatever the machine, with a grain small enough that every
+// container below is split five ways.
+mynamespace::ThreadPool &Pool() {
+  static mynamespace::ThreadPool pool(4);
+  return pool;
+}
+
+constexpr size_t kGrain = 16;
+
+template <class Container>
+std::vector<int> Contents(const Container &c) {
+  return std::vector<int>(c.cbegin(), c.cend());
+}
+
+}  // namespace
+
+TEST(test_parallel, ForEachAndTransform) {
+  mynamespace::List<int> a;
+  mynamespace::Vector<int> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  std::atomic<long> sum{0};
+  mynamespace::parallel::for_each(
+      a, [&sum](int x) { sum += x; }, kGrain, Pool());
+  ASSERT_EQ(sum, 499500);
+  mynamespace::parallel::for_each(
+      a, [](int &x) { x *= 2; }, kGrain, Pool());
+  mynamespace::parallel::transform_inplace(
+      b, [](int x) { return x * 2; }, kGrain, Pool());
+  ASSERT_EQ(Contents(a), Contents(b));
+  ASSERT_EQ(a.back(), 1998);
+  mynamespace::List<int> empty;
+  mynamespace::parallel::for_each(
+      empty, [](int &) { FAIL(); }, kGrain, Pool());
+}
+
+TEST(test_parallel, ReduceAndCountIf) {
+  mynamespace::List<int> a;
+  for (int i = 1; i <= 1003; ++i) a.push_back(i);
+  ASSERT_EQ(mynamespace::parallel::reduce(a, 0L, std::plus<>(), kGrain,
+                                          Pool()),
+            503506L);
+  ASSERT_EQ(mynamespace::parallel::reduce(a, 7L), 503513L);
+  // Not commutative: the segments must be folded in order.
+  mynamespace::Vector<std::vector<int>> pieces;
+  for (int i = 0; i < 100; ++i) pieces.push_back({i});
+  auto concat = [](std::vector<int> x, const std::vector<int> &y) {
+    x.insert(x.end(), y.begin(), y.end());
+    return x;
+  };
+  std::vector<int> joined = mynamespace::parallel::reduce(
+      pieces, std::vector<int>(), concat, kGrain, Pool());
+  ASSERT_EQ(joined.size(), 100U);
+  ASSERT_TRUE(std::is_sorted(joined.begin(), joined.end()));
+  auto even = [](int x) { return x % 2 == 0; };
+  ASSERT_EQ(mynamespace::parallel::count_if(a, even, kGrain, Pool()), 501U);
+  ASSERT_EQ(mynamespace::parallel::count_if(mynamespace::List<int>(), even,
+                                            kGrain, Pool()),
+            0U);
+}
+
+TEST(test_parallel, AdaptersThroughTheirContainers) {
+  mynamespace::Queue<int> q;
+  mynamespace::Stack<int> s;
+  for (int i = 0; i < 500; ++i) {
+    q.push(i);
+    s.push(i);
+  }
+  mynamespace::parallel::transform_inplace(
+      q, [](int x) { return x + 1; }, kGrain, Pool());
+  ASSERT_EQ(q.front(), 1);
+  ASSERT_EQ(q.back(), 500);
+  ASSERT_EQ(mynamespace::parallel::reduce(q, 0, std::plus<>(), kGrain,
+                                          Pool()),
+            125250);
+  const mynamespace::Stack<int> &view = s;
+  ASSERT_EQ(mynamespace::parallel::count_if(
+                view, [](int x) { return x < 100; }, kGrain, Pool()),
+            100U);
+  ASSERT_EQ(view.container().front(), 0);
+  ASSERT_EQ(s.top(), 499);
+}
+
+TEST(test_parallel, SortMatchesStableSort) {
+  std::mt19937 gen(5);
+  for (int n : {0, 1, 31, 32, 100, 1000, 4099}) {
+    std::vector<std::pair<int, int>> expected;
+    mynamespace::List<std::pair<int, int>> a;
+    for (int i = 0; i < n; ++i) {
+      expected.emplace_back(static_cast<int>(gen() % 50), i);
+      a.push_back(expected.back());
+    }
+    auto by_key = [](const std::pair<int, int> &x,
+                     const std::pair<int, int> &y) {
+      return x.first < y.first;
+    };
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+    mynamespace::parallel::sort(a, by_key, kGrain, Pool());
+    ASSERT_EQ(a.size(), static_cast<size_t>(n));
+    ASSERT_TRUE(std::equal(a.begin(), a.end(), expected.begin()));
+  }
+}
+
+TEST(test_parallel, SortArithmetic) {
+  std::mt19937 gen(9);
+  std::uniform_int_distribution<int> dist(std::numeric_limits<int>::min(),
+                                          std::numeric_limits<int>::max());
+  mynamespace::List<int> a;
+  std::vector<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    int x = dist(gen);
+    a.push_back(x);
+    expected.push_back(x);
+  }
+  std::sort(expected.begin(), expected.end());
+  mynamespace::parallel::sort(a, kGrain, Pool());
+  ASSERT_EQ(Contents(a), expected);
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  mynamespace::parallel::sort(a, std::greater<int>(), kGrain, Pool());
+  ASSERT_EQ(Contents(a), expected);
+  mynamespace::parallel::sort(a);
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(Contents(a), expected);
+}
+
+TEST(test_parallel, ExceptionsPropagate) {
+  mynamespace::Deque<int> a;
+  for (int i = 0; i < 1000; ++i) a.push_back(i);
+  std::atomic<int> visited{0};
+  ASSERT_THROW(mynamespace::parallel::for_each(
+                   a,
+                   [&visited](int x) {
+                     ++visited;
+                     if (x == 700) throw std::runtime_error("700");
+                   },
+                   kGrain, Pool()),
+               std::runtime_error);
+  ASSERT_GE(visited, 701);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+
+#include "my_list.h"
+#include "my_pool_allocator.h"
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_vector.h"
+
+TEST(test_pool_allocator, RecyclesChunks) {
+  mynamespace::PoolResource pool;
+  void *a = pool.allocate(24, alignof(int));
+  void *b = pool.allocate(24, alignof(int));
+  ASSERT_NE(a, b);
+  pool.deallocate(a, 24, alignof(int));
+  ASSERT_EQ(pool.allocate(24, alignof(int)), a);
+  pool.deallocate(a, 24, alignof(int));
+  pool.deallocate(b, 24, alignof(int));
+}
+
+TEST(test_pool_allocator, ChunksAreContiguous) {
+  mynamespace::PoolResource pool;
+  char *a = static_cast<char *>(pool.allocate(32, alignof(int)));
+  char *b = static_cast<char *>(pool.allocate(32, alignof(int)));
+  ASSERT_EQ(b - a, 32);
+}
+
+TEST(test_pool_allocator, LargeRequest) {
+  mynamespace::PoolResource pool;
+  size_t bytes = mynamespace::PoolResource::kMaxChunkSize + 1;
+  void *p = pool.allocate(bytes, alignof(int));
+  ASSERT_NE(p, nullptr);
+  pool.deallocate(p, bytes, alignof(int));
+}
+
+TEST(test_pool_allocator, OverAligned) {
+  struct alignas(64) Line {
+    int value;
+  };
+  mynamespace::PoolResource pool;
+  void *p = pool.allocate(sizeof(Line), alignof(Line));
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(p) % 64, 0U);
+  pool.deallocate(p, sizeof(Line), alignof(Line));
+  mynamespace::List<Line, mynamespace::PoolAllocator<Line>> a;
+  for (int i = 0; i < 100; ++i) {
+    a.push_back(Line{i});
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(&a.back()) % 64, 0U);
+  }
+  ASSERT_EQ(a.front().value, 0);
+}
+
+TEST(test_pool_allocator, Equality) {
+  mynamespace::PoolAllocator<int> a;
+  mynamespace::PoolAllocator<int> b;
+  mynamespace::PoolAllocator<double> c(a);
+  ASSERT_TRUE(a == c);
+  ASSERT_TRUE(a != b);
+  ASSERT_FALSE(a == a.select_on_container_copy_construction());
+}
+
+TEST(test_pool_allocator, List) {
+  mynamespace::List<std::string, mynamespace::PoolAllocator<std::string>> a{
+      "Misha", "Max", "Sasha"};
+  std::list<std::string> b{"Misha", "Max", "Sasha"};
+  for (int i = 0; i < 10000; ++i) {
+    a.push_back("Dasha");
+    a.push_front("Pasha");
+    b.push_back("Dasha");
+    b.push_front("Pasha");
+  }
+  for (int i = 0; i < 5000; ++i) {
+    a.pop_back();
+    a.pop_front();
+    b.pop_back();
+    b.pop_front();
+  }
+  ASSERT_EQ(a.size(), b.size());
+  auto it1 = a.begin();
+  auto it2 = b.begin();
+  for (; it2 != b.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+}
+
+TEST(test_pool_allocator, ListCopyMoveSwap) {
+  using PoolList = mynamespace::List<int, mynamespace::PoolAllocator<int>>;
+  PoolList a{1, 2, 3, 4};
+  PoolList b(a);
+  ASSERT_TRUE(a.get_allocator() != b.get_allocator());
+  PoolList c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(a.get_allocator() == c.get_allocator());
+  a.push_back(5);
+  b.swap(a);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(b.size(), 1U);
+  ASSERT_EQ(b.front(), 5);
+  ASSERT_EQ(c.back(), 4);
+}
+
+TEST(test_pool_allocator, ReuseAfterMove) {
+  mynamespace::PoolAllocator<int> a;
+  mynamespace::PoolAllocator<int> b(std::move(a));
+  ASSERT_TRUE(a == b);
+  using PoolVector = mynamespace::Vector<int, mynamespace::PoolAllocator<int>>;
+  PoolVector v{1, 2, 3};
+  PoolVector w(std::move(v));
+  v.push_back(4);
+  ASSERT_EQ(v.size(), 1U);
+  ASSERT_EQ(v[0], 4);
+  ASSERT_EQ(w.size(), 3U);
+  using PoolList = mynamespace::List<int, mynamespace::PoolAllocator<int>>;
+  PoolList l{1, 2};
+  PoolList m;
+  m = std::move(l);
+  l.push_back(3);
+  ASSERT_EQ(l.front(), 3);
+  ASSERT_EQ(m.back(), 2);
+}
+
+TEST(test_pool_allocator, QueueStack) {
+  using PoolList = mynamespace::List<int, mynamespace::PoolAllocator<int>>;
+  mynamespace::Queue<int, PoolList> a{1, 2, 3};
+  mynamespace::Stack<int, PoolList> b{1, 2, 3};
+  a.push(4);
+  b.push(4);
+  ASSERT_EQ(a.front(), 1);
+  ASSERT_EQ(a.back(), 4);
+  ASSERT_EQ(b.top(), 4);
+  a.pop();
+  b.pop();
+  ASSERT_EQ(a.front(), 2);
+  ASSERT_EQ(b.top(), 3);
+}
+
+TEST(test_pool_allocator, SpliceMergeAcrossPools) {
+  using PoolList = mynamespace::List<int, mynamespace::PoolAllocator<int>>;
+  PoolList a{1, 4, 7};
+  {
+    PoolList b{2, 5, 8};
+    PoolList c{3, 6, 9};
+    a.merge(b);
+    a.splice(a.cend(), c, c.cbegin());
+    a.splice(a.cend(), c);
+    ASSERT_TRUE(b.empty());
+    ASSERT_TRUE(c.empty());
+  }
+  std::list<int> d{1, 2, 4, 5, 7, 8, 3, 6, 9};
+  ASSERT_EQ(a.size(), d.size());
+  auto it1 = a.begin();
+  auto it2 = d.begin();
+  for (; it2 != d.end(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "my_list.h"
+#include "my_priority_queue.h"
+
+namespace {
+
+template <class Queue>
+std::vector<typename Queue::value_type> Drain(Queue &queue) {
+  std::vector<typename Queue::value_type> items;
+  while (!queue.empty()) {
+    items.push_back(queue.top());
+    queue.pop();
+  }
+  return items;
+}
+
+}  // namespace
+
+TEST(test_priority_queue, MatchesStd) {
+  std::mt19937 gen(7);
+  mynamespace::PriorityQueue<int> a;
+  std::priority_queue<int> b;
+  for (int i = 0; i < 1000; ++i) {
+    int value = static_cast<int>(gen() % 100);
+    a.push(value);
+    b.push(value);
+    if (i % 3 == 0) {
+      ASSERT_EQ(a.top(), b.top());
+      a.pop();
+      b.pop();
+    }
+  }
+  ASSERT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    ASSERT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_priority_queue, Heapify) {
+  mynamespace::PriorityQueue<std::string> a{"Misha", "Max", "Sasha"};
+  ASSERT_EQ(a.top(), "Sasha");
+  std::vector<int> values(200);
+  for (int i = 0; i < 200; ++i) values[i] = (i * 37) % 200;
+  mynamespace::PriorityQueue<int, mynamespace::Vector<int>, std::greater<int>>
+      b(values.begin(), values.end());
+  ASSERT_EQ(b.size(), 200U);
+  std::vector<int> sorted = Drain(b);
+  ASSERT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+  mynamespace::List<int> list = {3, 9, 1};
+  mynamespace::PriorityQueue<int> c(list.cbegin(), list.cend());
+  ASSERT_EQ(c.top(), 9);
+}
+
+TEST(test_priority_queue, InsertManyAndRange) {
+  mynamespace::PriorityQueue<int> a;
+  a.emplace(5);
+  a.insert_many(1, 8, 3);
+  ASSERT_EQ(a.top(), 8);
+  a.push(2);
+  std::vector<int> few = {7, 0};
+  a.push_range(few.begin(), few.end());
+  std::vector<int> many(100);
+  for (int i = 0; i < 100; ++i) many[i] = 100 + (i * 13) % 100;
+  a.push_range(many.begin(), many.end());
+  ASSERT_EQ(a.size(), 107U);
+  std::vector<int> drained = Drain(a);
+  ASSERT_TRUE(std::is_sorted(drained.rbegin(), drained.rend()));
+  ASSERT_EQ(drained.front(), 199);
+  ASSERT_EQ(drained.back(), 0);
+
+  mynamespace::PriorityQueue<int> b{1, 2};
+  mynamespace::PriorityQueue<int> c{5};
+  b.swap(c);
+  ASSERT_EQ(b.top(), 5);
+  ASSERT_EQ(c.size(), 2U);
+  mynamespace::PriorityQueue<int> d(std::move(c));
+  ASSERT_EQ(d.top(), 2);
+}
+
+TEST(test_priority_queue, Handles) {
+  mynamespace::HandlePriorityQueue<int, std::greater<int>> timers;
+  auto a = timers.push(30);
+  auto b = timers.push(10);
+  auto c = timers.push(20);
+  ASSERT_EQ(timers.top(), 10);
+  ASSERT_EQ(timers.top_handle(), b);
+  timers.update(a, 5);
+  ASSERT_EQ(timers.top_handle(), a);
+  timers.update(a, 50);
+  ASSERT_EQ(timers.top_handle(), b);
+  ASSERT_EQ(timers.value(a), 50);
+  timers.erase(b);
+  ASSERT_FALSE(timers.contains(b));
+  ASSERT_EQ(timers.top_handle(), c);
+  timers.pop();
+  ASSERT_FALSE(timers.contains(c));
+  ASSERT_TRUE(timers.contains(a));
+  ASSERT_EQ(timers.size(), 1U);
+  auto d = timers.emplace(1);
+  ASSERT_TRUE(d == b || d == c);
+  ASSERT_EQ(timers.top(), 1);
+  timers.pop();
+  timers.pop();
+  ASSERT_TRUE(timers.empty());
+  timers.pop();
+  ASSERT_TRUE(timers.empty());
+  mynamespace::PriorityQueue<int> empty;
+  empty.pop();
+  ASSERT_EQ(empty.size(), 0U);
+  empty.push(3);
+  ASSERT_EQ(empty.top(), 3);
+}
+
+TEST(test_priority_queue, HandlesMatchRebuild) {
+  std::mt19937 gen(11);
+  mynamespace::HandlePriorityQueue<int> queue;
+  std::vector<size_t> handles;
+  std::vector<int> values;
+  for (int i = 0; i < 300; ++i) {
+    int value = static_cast<int>(gen() % 1000);
+    handles.push_back(queue.push(value));
+    values.push_back(value);
+  }
+  for (int i = 0; i < 300; i += 2) {
+    values[i] = static_cast<int>(gen() % 1000);
+    queue.update(handles[i], values[i]);
+  }
+  for (int i = 1; i < 300; i += 3) {
+    queue.erase(handles[i]);
+    values[i] = -1;
+  }
+  values.erase(std::remove(values.begin(), values.end(), -1), values.end());
+  std::sort(values.rbegin(), values.rend());
+  ASSERT_EQ(Drain(queue), values);
+}
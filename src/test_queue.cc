@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <queue>
 
 #include "my_queue.h"
+#include "test_values.h"
 
 TEST(test_queue, DefaultConstructor) {
   mynamespace::Queue<int> a;
@@ -135,3 +137,31 @@ TEST(test_queue, InsertManyBack) {
     b.pop();
   }
 }
+
+TEST(test_queue, PushMoveEmplace) {
+  mynamespace::Queue<Message> a;
+  Message m("moved", 1);
+  Message::reset();
+  a.push(std::move(m));
+  a.emplace("emplaced", 2);
+  a.insert_many_back(Message("many", 3), Message("many", 4));
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(Message::moves, 3);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(a.front().id, 1);
+}
+
+TEST(test_queue, PushRange) {
+  int values[] = {1, 2, 3};
+  mynamespace::Queue<int> a;
+  a.push(0);
+  a.push_range(std::begin(values), std::end(values));
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(a.front(), 0);
+  ASSERT_EQ(a.back(), 3);
+  mynamespace::Queue<int, mynamespace::List<int>> b;
+  b.push_range(std::begin(values), std::end(values));
+  ASSERT_EQ(b.size(), 3U);
+  ASSERT_EQ(b.front(), 1);
+  ASSERT_EQ(b.back(), 3);
+}
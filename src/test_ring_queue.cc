@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <string>
+
+#include "my_ring_queue.h"
+
+TEST(test_ring_queue, StaticCapacity) {
+  mynamespace::RingQueue<int, 5> a;
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 5U);
+  for (int i = 0; i < 5; ++i) ASSERT_TRUE(a.try_push(i));
+  ASSERT_TRUE(a.full());
+  ASSERT_FALSE(a.try_push(5));
+  ASSERT_THROW(a.push(5), std::length_error);
+  ASSERT_EQ(a.size(), 5U);
+  ASSERT_EQ(a.front(), 0);
+  ASSERT_EQ(a.back(), 4);
+}
+
+TEST(test_ring_queue, RuntimeCapacity) {
+  mynamespace::RingQueue<std::string> a(3);
+  ASSERT_EQ(a.capacity(), 3U);
+  ASSERT_TRUE(a.try_push("Misha"));
+  ASSERT_TRUE(a.try_emplace(3, 'x'));
+  a.push("Sasha");
+  ASSERT_FALSE(a.try_push("Max"));
+  ASSERT_EQ(a.front(), "Misha");
+  ASSERT_EQ(a.back(), "Sasha");
+  std::string value;
+  ASSERT_TRUE(a.try_pop(value));
+  ASSERT_EQ(value, "Misha");
+  ASSERT_EQ(a.front(), "xxx");
+  a.pop();
+  a.pop();
+  ASSERT_TRUE(a.empty());
+  a.pop();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.size(), 0U);
+  a.push("Pasha");
+  ASSERT_EQ(a.front(), "Pasha");
+  mynamespace::RingQueue<std::string> b{"a", "b"};
+  ASSERT_EQ(b.capacity(), 2U);
+  ASSERT_TRUE(b.full());
+}
+
+TEST(test_ring_queue, WrapAround) {
+  mynamespace::RingQueue<std::string, 7> a;
+  std::queue<std::string> b;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 != 2) {
+      std::string value = std::to_string(i);
+      if (a.try_push(value)) b.push(value);
+    } else if (!b.empty()) {
+      ASSERT_EQ(a.front(), b.front());
+      a.pop();
+      b.pop();
+    }
+    ASSERT_EQ(a.size(), b.size());
+    if (!b.empty()) {
+      ASSERT_EQ(a.back(), b.back());
+    }
+  }
+}
+
+TEST(test_ring_queue, CopyMoveSwap) {
+  mynamespace::RingQueue<std::string, 4> a{"1", "2", "3"};
+  mynamespace::RingQueue<std::string, 4> b(a);
+  ASSERT_EQ(b.size(), 3U);
+  mynamespace::RingQueue<std::string, 4> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(c.front(), "1");
+  c.pop();
+  c.swap(b);
+  ASSERT_EQ(c.front(), "1");
+  ASSERT_EQ(b.front(), "2");
+
+  mynamespace::RingQueue<std::string> d(4);
+  d.insert_many_back("x", "y");
+  mynamespace::RingQueue<std::string> e(std::move(d));
+  ASSERT_EQ(e.size(), 2U);
+  ASSERT_EQ(e.back(), "y");
+  ASSERT_FALSE(d.try_push("z"));
+  d = std::move(e);
+  ASSERT_EQ(d.front(), "x");
+  ASSERT_THROW(d.insert_many_back("1", "2", "3"), std::length_error);
+  ASSERT_EQ(d.size(), 2U);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "my_set.h"
+
+namespace {
+
+// Wide enough that a node holds only three of them, so a few hundred keys
+// make a deep tree and every split, rotation and merge path runs.
+struct WideKey {
+  WideKey(int key = 0) : key(key), name(std::to_string(key)) {}
+
+  bool operator<(const WideKey &other) const { return key < other.key; }
+
+  int key;
+  std::string name;
+  char padding[200];
+};
+
+template <class Container>
+std::vector<int> Keys(const Container &c) {
+  std::vector<int> keys;
+  for (const auto &item : c) keys.push_back(item.key);
+  return keys;
+}
+
+template <class T>
+std::vector<T> Items(const mynamespace::Set<T> &s) {
+  return {s.begin(), s.end()};
+}
+
+}  // namespace
+
+TEST(test_set, InsertFind) {
+  mynamespace::Set<std::string> a{"Misha", "Max", "Sasha", "Max"};
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(Items(a), (std::vector<std::string>{"Max", "Misha", "Sasha"}));
+  auto [it, inserted] = a.insert("Dasha");
+  ASSERT_TRUE(inserted);
+  ASSERT_EQ(*it, "Dasha");
+  ASSERT_FALSE(a.insert("Max").second);
+  ASSERT_TRUE(a.contains("Sasha"));
+  ASSERT_FALSE(a.contains("Pasha"));
+  ASSERT_EQ(a.find("Pasha"), a.end());
+  ASSERT_EQ(*a.find("Misha"), "Misha");
+  ASSERT_EQ(a.count("Misha"), 1U);
+  ASSERT_EQ(*a.emplace(3, 'x').first, "xxx");
+  ASSERT_EQ(*a.lower_bound("N"), "Sasha");
+  ASSERT_EQ(*a.upper_bound("Max"), "Misha");
+  ASSERT_EQ(a.upper_bound("z"), a.end());
+}
+
+TEST(test_set, IterateBothWays) {
+  mynamespace::Set<int> a;
+  for (int i = 0; i < 1000; ++i) a.insert((i * 7919) % 1000);
+  ASSERT_EQ(a.size(), 1000U);
+  int expected = 0;
+  for (int key : a) ASSERT_EQ(key, expected++);
+  auto it = a.end();
+  for (int i = 999; i >= 0; --i) ASSERT_EQ(*--it, i);
+  ASSERT_EQ(it, a.begin());
+  auto range = a.equal_range(500);
+  ASSERT_EQ(*range.first, 500);
+  ASSERT_EQ(*range.second, 501);
+}
+
+TEST(test_set, EraseReturnsNext) {
+  mynamespace::Set<int> a;
+  for (int i = 0; i < 500; ++i) a.insert(i);
+  for (auto it = a.begin(); it != a.end();) {
+    int key = *it;
+    it = key % 3 == 0 ? a.erase(it) : std::next(it);
+    if (it != a.end()) {
+      ASSERT_GT(*it, key);
+    }
+  }
+  ASSERT_EQ(a.size(), 333U);
+  ASSERT_EQ(a.erase(1), 1U);
+  ASSERT_EQ(a.erase(3), 0U);
+  ASSERT_EQ(*a.begin(), 2);
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.begin(), a.end());
+}
+
+TEST(test_set, MatchesStdUnderChurn) {
+  std::mt19937 gen(3);
+  mynamespace::Set<WideKey> a;
+  std::set<WideKey> b;
+  for (int round = 0; round < 4000; ++round) {
+    int key = static_cast<int>(gen() % 400);
+    if (gen() % 3 == 0) {
+      auto it = a.find(key);
+      ASSERT_EQ(it == a.end(), b.find(key) == b.end());
+      if (it != a.end()) {
+        auto next = a.erase(it);
+        auto expected = b.upper_bound(key);
+        ASSERT_EQ(next == a.end(), expected == b.end());
+        if (next != a.end()) {
+          ASSERT_EQ(next->name, expected->name);
+        }
+        b.erase(key);
+      }
+    } else {
+      ASSERT_EQ(a.insert(key).second, b.insert(key).second);
+    }
+    ASSERT_EQ(a.size(), b.size());
+  }
+  ASSERT_EQ(Keys(a), Keys(b));
+  mynamespace::Set<WideKey> copy(a);
+  ASSERT_EQ(Keys(copy), Keys(b));
+  while (!b.empty()) {
+    ASSERT_EQ(a.begin()->key, b.begin()->key);
+    a.erase(a.begin());
+    b.erase(b.begin());
+  }
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(copy.size(), Keys(copy).size());
+}
+
+TEST(test_set, MoveSwapMerge) {
+  mynamespace::Set<int> a{1, 2, 3};
+  mynamespace::Set<int> b{3, 4};
+  a.merge(b);
+  ASSERT_EQ(Items(a), (std::vector<int>{1, 2, 3, 4}));
+  ASSERT_EQ(Items(b), (std::vector<int>{3}));
+  mynamespace::Set<int> c(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(c.size(), 4U);
+  c.swap(b);
+  ASSERT_EQ(Items(c), (std::vector<int>{3}));
+  a = std::move(b);
+  ASSERT_EQ(a.size(), 4U);
+}
+
+TEST(test_set, InsertMany) {
+  mynamespace::Set<int> a{5};
+  auto result = a.insert_many(1, 5, 9, 1);
+  ASSERT_EQ(result.size(), 4U);
+  ASSERT_TRUE(result[0].second);
+  ASSERT_FALSE(result[1].second);
+  ASSERT_TRUE(result[2].second);
+  ASSERT_FALSE(result[3].second);
+  ASSERT_EQ(*result[0].first, 1);
+  ASSERT_EQ(*result[1].first, 5);
+  ASSERT_EQ(*result[2].first, 9);
+  ASSERT_EQ(a.size(), 3U);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "my_small_vector.h"
+#include "my_stack.h"
+
+namespace {
+
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  static int allocations;
+
+  CountingAllocator() = default;
+  template <class U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+template <class T>
+int CountingAllocator<T>::allocations = 0;
+
+using Counted = mynamespace::SmallVector<int, 4, CountingAllocator<int>>;
+using Names = mynamespace::SmallVector<std::string, 2>;
+
+template <class Container>
+std::vector<typename Container::value_type> Items(const Container &c) {
+  return {c.cbegin(), c.cend()};
+}
+
+}  // namespace
+
+TEST(test_small_vector, InlineUntilFull) {
+  CountingAllocator<int>::allocations = 0;
+  Counted a;
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 4U);
+  a.insert_many_back(1, 2, 3, 4);
+  ASSERT_TRUE(a.is_inline());
+  ASSERT_EQ(CountingAllocator<int>::allocations, 0);
+  a.push_back(a[0]);
+  ASSERT_FALSE(a.is_inline());
+  ASSERT_EQ(CountingAllocator<int>::allocations, 1);
+  ASSERT_EQ(a.capacity(), 8U);
+  ASSERT_EQ(Items(a), (std::vector<int>{1, 2, 3, 4, 1}));
+  ASSERT_EQ(a.back(), 1);
+  ASSERT_THROW(a.at(5), std::out_of_range);
+}
+
+TEST(test_small_vector, ReserveShrink) {
+  Names a{"Misha"};
+  a.reserve(2);
+  ASSERT_TRUE(a.is_inline());
+  a.reserve(10);
+  ASSERT_FALSE(a.is_inline());
+  ASSERT_EQ(a.capacity(), 10U);
+  a.push_back("Max");
+  a.push_back("Sasha");
+  a.shrink_to_fit();
+  ASSERT_EQ(a.capacity(), 3U);
+  a.pop_back();
+  a.shrink_to_fit();
+  ASSERT_TRUE(a.is_inline());
+  ASSERT_EQ(a.capacity(), 2U);
+  ASSERT_EQ(Items(a), (std::vector<std::string>{"Misha", "Max"}));
+  a.clear();
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_small_vector, MoveCopySwap) {
+  Names small{"Misha"};
+  Names big{"Max", "Sasha", "Dasha"};
+  Names copy(big);
+  ASSERT_EQ(Items(copy), Items(big));
+  Names moved(std::move(small));
+  ASSERT_TRUE(moved.is_inline());
+  ASSERT_TRUE(small.empty());
+  const std::string *heap = big.data();
+  Names stolen(std::move(big));
+  ASSERT_EQ(stolen.data(), heap);
+  ASSERT_TRUE(big.is_inline());
+  ASSERT_TRUE(big.empty());
+  moved.swap(stolen);
+  ASSERT_EQ(Items(moved), (std::vector<std::string>{"Max", "Sasha", "Dasha"}));
+  ASSERT_EQ(Items(stolen), (std::vector<std::string>{"Misha"}));
+  ASSERT_TRUE(stolen.is_inline());
+  stolen = std::move(moved);
+  ASSERT_EQ(stolen.size(), 3U);
+  ASSERT_TRUE(moved.empty());
+  big.push_back("Pasha");
+  ASSERT_EQ(big.front(), "Pasha");
+}
+
+TEST(test_small_vector, InsertErase) {
+  mynamespace::SmallVector<int, 3> a{1, 4};
+  a.insert(a.begin() + 1, 3);
+  a.emplace(a.cbegin() + 1, 2);
+  ASSERT_EQ(Items(a), (std::vector<int>{1, 2, 3, 4}));
+  a.erase(a.begin());
+  ASSERT_EQ(Items(a), (std::vector<int>{2, 3, 4}));
+  auto it = a.insert_many(a.cbegin(), 0, 1);
+  ASSERT_EQ(*it, 2);
+  ASSERT_EQ(Items(a), (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(test_small_vector, InsertManyAliasing) {
+  mynamespace::SmallVector<std::string, 2> a{"first", "second"};
+  a.insert_many_back(a[0], a[1]);
+  ASSERT_FALSE(a.is_inline());
+  a.shrink_to_fit();
+  a.insert_many(a.cbegin() + 1, a[3], a[0]);
+  ASSERT_EQ(Items(a), (std::vector<std::string>{"first", "second", "first",
+                                                "second", "first", "second"}));
+}
+
+TEST(test_small_vector, StackBackend) {
+  mynamespace::SmallStack<std::string, 2> stack;
+  stack.push("Misha");
+  stack.emplace("Max");
+  ASSERT_EQ(stack.top(), "Max");
+  stack.insert_many_front("Sasha", "Dasha");
+  ASSERT_EQ(stack.size(), 4U);
+  ASSERT_EQ(stack.top(), "Dasha");
+  mynamespace::SmallStack<std::string, 2> other;
+  other.push("Pasha");
+  stack.swap(other);
+  ASSERT_EQ(stack.top(), "Pasha");
+  ASSERT_EQ(other.size(), 4U);
+  other.pop();
+  other.pop();
+  ASSERT_EQ(other.top(), "Max");
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "my_spsc_queue.h"
+
+TEST(test_spsc_queue, SingleThread) {
+  mynamespace::SpscQueue<std::string> a(3);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 3U);
+  ASSERT_TRUE(a.try_push("Misha"));
+  a.push("Max");
+  ASSERT_TRUE(a.try_emplace(3, 'x'));
+  ASSERT_FALSE(a.try_push("Sasha"));
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a.front(), "Misha");
+  a.pop();
+  std::string value;
+  ASSERT_TRUE(a.try_pop(value));
+  ASSERT_EQ(value, "Max");
+  ASSERT_TRUE(a.try_pop(value));
+  ASSERT_EQ(value, "xxx");
+  ASSERT_FALSE(a.try_pop(value));
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_spsc_queue, PopEmpty) {
+  mynamespace::SpscQueue<std::string> a(2);
+  a.pop();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.size(), 0U);
+  a.push("Misha");
+  a.pop();
+  a.pop();
+  ASSERT_EQ(a.size(), 0U);
+  a.push("Max");
+  a.push("Sasha");
+  ASSERT_FALSE(a.try_push("Nina"));
+  ASSERT_EQ(a.front(), "Max");
+  a.pop();
+  ASSERT_EQ(a.front(), "Sasha");
+}
+
+TEST(test_spsc_queue, Batches) {
+  mynamespace::SpscQueue<int> a(5);
+  std::vector<int> in{1, 2, 3, 4, 5, 6, 7};
+  ASSERT_EQ(a.push_n(in.begin(), in.size()), 5U);
+  std::vector<int> out(7);
+  ASSERT_EQ(a.pop_n(out.begin(), 2), 2U);
+  ASSERT_EQ(a.push_n(in.begin() + 5, 2), 2U);
+  ASSERT_EQ(a.pop_n(out.begin() + 2, 10), 5U);
+  ASSERT_EQ(out, in);
+  ASSERT_EQ(a.pop_n(out.begin(), 1), 0U);
+}
+
+TEST(test_spsc_queue, DestroysRemaining) {
+  auto item = std::make_shared<int>(1);
+  {
+    mynamespace::SpscQueue<std::shared_ptr<int>> a(4);
+    a.push(item);
+    a.push(item);
+    ASSERT_EQ(item.use_count(), 3);
+  }
+  ASSERT_EQ(item.use_count(), 1);
+}
+
+TEST(test_spsc_queue, TwoThreadStress) {
+  constexpr int kCount = 200000;
+  mynamespace::SpscQueue<int> a(64);
+  std::thread producer([&a] {
+    for (int i = 0; i < kCount; ++i) {
+      if (i % 2) {
+        a.push(i);
+      } else {
+        while (!a.try_push(i)) std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  while (expected < kCount) {
+    int value;
+    if (a.try_pop(value)) {
+      ASSERT_EQ(value, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_spsc_queue, TwoThreadBatchStress) {
+  constexpr int kCount = 200000;
+  mynamespace::SpscQueue<std::string> a(100);
+  std::thread producer([&a] {
+    std::vector<std::string> batch(37);
+    int next = 0;
+    while (next < kCount) {
+      size_t n = std::min<size_t>(batch.size(), kCount - next);
+      for (size_t i = 0; i < n; ++i) batch[i] = std::to_string(next + i);
+      size_t pushed = 0;
+      while (pushed < n) {
+        pushed += a.push_n(batch.begin() + pushed, n - pushed);
+        std::this_thread::yield();
+      }
+      next += n;
+    }
+  });
+  std::vector<std::string> out(29);
+  int expected = 0;
+  while (expected < kCount) {
+    size_t n = a.pop_n(out.begin(), out.size());
+    for (size_t i = 0; i < n; ++i, ++expected) {
+      ASSERT_EQ(out[i], std::to_string(expected));
+    }
+    if (n == 0) std::this_thread::yield();
+  }
+  producer.join();
+}
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <stack>
 
 #include "my_stack.h"
+#include "test_values.h"
 
 TEST(tests_stack, DefaultConstructor) {
   mynamespace::Stack<int> a;
@@ -129,3 +131,43 @@ TEST(tests_stack, InsertManyFront) {
     b.pop();
   }
 }
+
+TEST(tests_stack, PushMoveEmplace) {
+  mynamespace::Stack<Message, mynamespace::List<Message>> a;
+  Message m("moved", 1);
+  Message::reset();
+  a.push(std::move(m));
+  a.emplace("emplaced", 2);
+  a.insert_many_front(Message("many", 3), Message("many", 4));
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(Message::moves, 3);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(a.top().id, 4);
+}
+
+TEST(tests_stack, PushMoveEmplaceVector) {
+  mynamespace::Stack<Message> a;
+  Message m("moved", 1);
+  Message::reset();
+  a.push(std::move(m));
+  a.emplace("emplaced", 2);
+  a.insert_many_front(Message("many", 3), Message("many", 4));
+  ASSERT_EQ(Message::copies, 0);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_EQ(a.top().id, 4);
+}
+
+TEST(test_stack, PushRange) {
+  int values[] = {1, 2, 3};
+  mynamespace::Stack<int> a;
+  a.push_range(std::begin(values), std::end(values));
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a.top(), 3);
+  mynamespace::Stack<int, mynamespace::List<int>> b;
+  b.push(0);
+  b.push_range(std::begin(values), std::end(values));
+  ASSERT_EQ(b.size(), 4U);
+  ASSERT_EQ(b.top(), 3);
+  b.pop();
+  ASSERT_EQ(b.top(), 2);
+}
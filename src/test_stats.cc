@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "my_deque.h"
+#include "my_list.h"
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_stats.h"
+#include "my_vector.h"
+
+namespace {
+
+using PlainList =
+    mynamespace::List<int, std::allocator<int>, mynamespace::NoStats>;
+using CountedList =
+    mynamespace::List<int, std::allocator<int>, mynamespace::CountingStats>;
+using CountedVector =
+    mynamespace::Vector<int, std::allocator<int>, mynamespace::CountingStats>;
+using CountedDeque =
+    mynamespace::Deque<int, std::allocator<int>, mynamespace::CountingStats>;
+using mynamespace::StatsOp;
+
+}  // namespace
+
+TEST(test_stats, DisabledIsFree) {
+  static_assert(std::is_empty_v<mynamespace::NoStats>);
+  ASSERT_EQ(sizeof(PlainList),
+            sizeof(CountedList) - sizeof(mynamespace::CountingStats));
+  ASSERT_EQ(sizeof(mynamespace::Queue<int, PlainList, mynamespace::NoStats>),
+            sizeof(PlainList));
+  ASSERT_EQ(sizeof(mynamespace::Stack<int, mynamespace::Vector<int>,
+                                      mynamespace::NoStats>),
+            sizeof(mynamespace::Vector<int>));
+  ASSERT_EQ(sizeof(mynamespace::Vector<int, std::allocator<int>,
+                                       mynamespace::NoStats>),
+            sizeof(CountedVector) - sizeof(mynamespace::CountingStats));
+  ASSERT_EQ(sizeof(mynamespace::Deque<int, std::allocator<int>,
+                                      mynamespace::NoStats>),
+            sizeof(CountedDeque) - sizeof(mynamespace::CountingStats));
+  PlainList a = {3, 1, 2};
+  a.sort();
+  ASSERT_EQ(a.stats().count(StatsOp::kSort), 0U);
+  ASSERT_EQ(a.stats().allocations, 0U);
+}
+
+TEST(test_stats, ListCounters) {
+  CountedList a;
+  a.push_back(3);
+  a.push_front(1);
+  a.emplace_back(2);
+  a.pop_back();
+  a.sort();
+  a.sort();
+  mynamespace::ContainerStats s = a.stats();
+  ASSERT_EQ(s.allocations, 3U);
+  ASSERT_EQ(s.deallocations, 1U);
+  ASSERT_EQ(s.bytes_allocated, 3 * (s.bytes_allocated / 3));
+  ASSERT_EQ(s.bytes_in_use, s.bytes_allocated - s.bytes_freed);
+  ASSERT_EQ(s.peak_bytes, s.bytes_allocated);
+  ASSERT_EQ(s.peak_size, 3U);
+  ASSERT_EQ(s.count(StatsOp::kInsert), 3U);
+  ASSERT_EQ(s.count(StatsOp::kErase), 1U);
+  ASSERT_EQ(s.count(StatsOp::kSort), 2U);
+  a.clear();
+  s = a.stats();
+  ASSERT_EQ(s.deallocations, 3U);
+  ASSERT_EQ(s.bytes_in_use, 0U);
+  ASSERT_EQ(s.count(StatsOp::kClear), 1U);
+}
+
+TEST(test_stats, SplicedBytesFollowNodes) {
+  CountedList a = {1, 2, 3};
+  CountedList b = {4};
+  size_t node = a.stats().bytes_allocated / 3;
+  a.splice(a.cbegin(), b);
+  ASSERT_EQ(a.stats().bytes_in_use, 4 * node);
+  ASSERT_EQ(b.stats().bytes_in_use, 0U);
+  ASSERT_EQ(a.stats().peak_size, 4U);
+  ASSERT_EQ(a.stats().count(StatsOp::kSplice), 1U);
+  CountedList c(std::move(a));
+  ASSERT_EQ(c.stats().bytes_in_use, 4 * node);
+  ASSERT_EQ(c.stats().allocations, 0U);
+  ASSERT_EQ(a.stats().bytes_in_use, 0U);
+}
+
+TEST(test_stats, SwapTradesNodesAndBytes) {
+  CountedList a = {1, 2, 3};
+  CountedList b;
+  size_t node = a.stats().bytes_allocated / 3;
+  a.swap(b);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.cbegin(), a.cend());
+  ASSERT_EQ(a.stats().bytes_in_use, 0U);
+  ASSERT_EQ(b.size(), 3U);
+  ASSERT_EQ(b.front(), 1);
+  ASSERT_EQ(b.back(), 3);
+  ASSERT_EQ(b.stats().bytes_in_use, 3 * node);
+  a.push_back(4);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(*--a.end(), 3);
+  ASSERT_EQ(b.front(), 4);
+  ASSERT_EQ(*--b.end(), 4);
+  ASSERT_EQ(a.stats().bytes_in_use, 3 * node);
+  ASSERT_EQ(b.stats().bytes_in_use, node);
+  b = std::move(a);
+  ASSERT_EQ(b.size(), 3U);
+  ASSERT_EQ(b.stats().bytes_in_use, 3 * node);
+  CountedList empty;
+  empty.swap(a);
+  ASSERT_EQ(empty.size(), 1U);
+  ASSERT_EQ(empty.front(), 4);
+  ASSERT_EQ(a.cbegin(), a.cend());
+}
+
+TEST(test_stats, VectorCountsArrays) {
+  CountedVector v;
+  ASSERT_EQ(v.stats().allocations, 0U);
+  v.reserve(4);
+  v.push_back(1);
+  v.push_back(2);
+  mynamespace::ContainerStats s = v.stats();
+  ASSERT_EQ(s.allocations, 1U);
+  ASSERT_EQ(s.bytes_in_use, 4 * sizeof(int));
+  ASSERT_EQ(s.peak_size, 2U);
+  v.insert_many_back(3, 4, 5);
+  s = v.stats();
+  ASSERT_EQ(s.allocations, 2U);
+  ASSERT_EQ(s.deallocations, 1U);
+  ASSERT_EQ(s.bytes_in_use, v.capacity() * sizeof(int));
+  ASSERT_EQ(s.peak_size, 5U);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.stats().bytes_in_use, 5 * sizeof(int));
+
+  CountedVector w(std::move(v));
+  ASSERT_EQ(w.stats().bytes_in_use, 5 * sizeof(int));
+  ASSERT_EQ(v.stats().bytes_in_use, 0U);
+  v.push_back(6);
+  v.swap(w);
+  ASSERT_EQ(v.stats().bytes_in_use, 5 * sizeof(int));
+  ASSERT_EQ(w.stats().bytes_in_use, w.capacity() * sizeof(int));
+}
+
+TEST(test_stats, DequeCountsBlocksAndMap) {
+  CountedDeque d;
+  ASSERT_EQ(d.stats().allocations, 0U);
+  for (int i = 0; i < 1000; ++i) d.push_back(i);
+  d.push_front(-1);
+  mynamespace::ContainerStats s = d.stats();
+  ASSERT_GT(s.allocations, 2U);
+  ASSERT_EQ(s.bytes_in_use, s.bytes_allocated - s.bytes_freed);
+  ASSERT_EQ(s.peak_size, 1001U);
+
+  CountedDeque e(std::move(d));
+  ASSERT_EQ(e.stats().bytes_in_use, s.bytes_in_use);
+  ASSERT_EQ(d.stats().bytes_in_use, 0U);
+  d.push_back(1);
+  size_t small = d.stats().bytes_in_use;
+  d.swap(e);
+  ASSERT_EQ(d.stats().bytes_in_use, s.bytes_in_use);
+  ASSERT_EQ(e.stats().bytes_in_use, small);
+  d.clear();
+  d.shrink_to_fit();
+  ASSERT_GT(d.stats().bytes_in_use, 0U);
+  ASSERT_LT(d.stats().bytes_in_use, small);
+}
+
+TEST(test_stats, Adapters) {
+  mynamespace::Queue<int, CountedList, mynamespace::CountingStats> q;
+  q.push(1);
+  q.emplace(2);
+  q.insert_many_back(3, 4);
+  q.pop();
+  mynamespace::ContainerStats s = q.stats();
+  ASSERT_EQ(s.count(StatsOp::kPush), 4U);
+  ASSERT_EQ(s.count(StatsOp::kPop), 1U);
+  ASSERT_EQ(s.count(StatsOp::kInsert), 4U);
+  ASSERT_EQ(s.allocations, 4U);
+  ASSERT_EQ(s.peak_size, 4U);
+
+  mynamespace::Stack<int, CountedVector, mynamespace::CountingStats> st;
+  st.push(1);
+  st.push(2);
+  st.pop();
+  ASSERT_EQ(st.stats().count(StatsOp::kPush), 2U);
+  ASSERT_EQ(st.stats().count(StatsOp::kPop), 1U);
+  ASSERT_EQ(st.stats().peak_size, 2U);
+  ASSERT_EQ(st.stats().allocations, 2U);
+
+  mynamespace::Queue<int, CountedDeque, mynamespace::CountingStats> dq;
+  dq.push(1);
+  dq.pop();
+  ASSERT_GT(dq.stats().allocations, 0U);
+  ASSERT_EQ(dq.stats().bytes_in_use, dq.stats().bytes_allocated -
+                                         dq.stats().bytes_freed);
+}
+
+TEST(test_stats, Registry) {
+  mynamespace::StatsRegistry &registry = mynamespace::StatsRegistry::instance();
+  size_t live = registry.live("List");
+  size_t sorts = registry.total("List").count(StatsOp::kSort);
+  {
+    CountedList a = {2, 1};
+    CountedList b;
+    ASSERT_EQ(registry.live("List"), live + 2);
+    a.sort();
+  }
+  ASSERT_EQ(registry.live("List"), live);
+  ASSERT_EQ(registry.total("List").count(StatsOp::kSort), sorts + 1);
+
+  std::ostringstream out;
+  registry.dump(out);
+  ASSERT_NE(out.str().find("List: live"), std::string::npos);
+  ASSERT_NE(out.str().find("sort"), std::string::npos);
+  ASSERT_EQ(registry.total("nothing").allocations, 0U);
+}
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "my_thread_pool.h"
+
+TEST(test_thread_pool, RunsEveryTask) {
+  std::atomic<int> sum{0};
+  {
+    mynamespace::ThreadPool pool(3);
+    ASSERT_EQ(pool.size(), 3U);
+    for (int i = 1; i <= 1000; ++i) {
+      pool.submit([&sum, i] { sum += i; });
+    }
+  }
+  ASSERT_EQ(sum, 500500);
+}
+
+TEST(test_thread_pool, CallerRunsQueuedTasks) {
+  mynamespace::ThreadPool pool(0);
+  ASSERT_EQ(pool.size(), 0U);
+  ASSERT_FALSE(pool.run_one());
+  std::thread::id ran_on;
+  pool.submit([&ran_on] { ran_on = std::this_thread::get_id(); });
+  ASSERT_TRUE(pool.run_one());
+  ASSERT_EQ(ran_on, std::this_thread::get_id());
+  ASSERT_FALSE(pool.run_one());
+}
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <vector>
+
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_unrolled_list.h"
+
+namespace {
+
+template <class Unrolled, class Reference>
+void ExpectEqual(const Unrolled &a, const Reference &b) {
+  ASSERT_EQ(a.size(), b.size());
+  auto it1 = a.cbegin();
+  auto it2 = b.cbegin();
+  for (; it2 != b.cend(); ++it1, ++it2) {
+    ASSERT_EQ(*it1, *it2);
+  }
+  ASSERT_TRUE(it1 == a.cend());
+  auto it3 = a.cend();
+  auto it4 = b.cend();
+  while (it4 != b.cbegin()) {
+    --it3;
+    --it4;
+    ASSERT_EQ(*it3, *it4);
+  }
+}
+
+template <class Unrolled>
+size_t CountChunks(Unrolled &a) {
+  size_t chunks = 0;
+  for (auto it = a.begin(), prev = a.end(); it != a.end(); prev = it, ++it) {
+    if (it.chunk_ != prev.chunk_) ++chunks;
+  }
+  return chunks;
+}
+
+struct CountedMoves {
+  static inline int moves = 0;
+  int value;
+  CountedMoves(int v) : value(v) {}
+  CountedMoves(CountedMoves &&other) noexcept : value(other.value) { ++moves; }
+  CountedMoves &operator=(CountedMoves &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+};
+
+}  // namespace
+
+TEST(test_unrolled_list, DefaultConstructor) {
+  mynamespace::UnrolledList<int> a;
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.size(), 0U);
+  ASSERT_TRUE(a.begin() == a.end());
+}
+
+TEST(test_unrolled_list, Constructors) {
+  mynamespace::UnrolledList<std::string, 4> a{"Misha", "Max", "Sasha",
+                                              "Dasha", "Pasha"};
+  std::list<std::string> b{"Misha", "Max", "Sasha", "Dasha", "Pasha"};
+  ExpectEqual(a, b);
+  mynamespace::UnrolledList<std::string, 4> c(a);
+  ExpectEqual(c, b);
+  mynamespace::UnrolledList<std::string, 4> d(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ExpectEqual(d, b);
+  a = std::move(d);
+  ExpectEqual(a, b);
+  mynamespace::UnrolledList<int, 4> e(9);
+  ExpectEqual(e, std::list<int>(9));
+}
+
+TEST(test_unrolled_list, PushPop) {
+  mynamespace::UnrolledList<int, 4> a;
+  std::list<int> b;
+  for (int i = 0; i < 50; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  ExpectEqual(a, b);
+  for (int i = 0; i < 30; ++i) {
+    a.pop_back();
+    b.pop_back();
+    a.pop_front();
+    b.pop_front();
+  }
+  ExpectEqual(a, b);
+  ASSERT_EQ(a.front(), b.front());
+  ASSERT_EQ(a.back(), b.back());
+  a.clear();
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(test_unrolled_list, InsertErase) {
+  mynamespace::UnrolledList<int, 4> a{1, 2, 3, 4, 5, 6, 7, 8};
+  std::list<int> b{1, 2, 3, 4, 5, 6, 7, 8};
+  auto it1 = a.begin();
+  auto it2 = b.begin();
+  ++it1;
+  ++it2;
+  ++it1;
+  ++it2;
+  it1 = a.insert(it1, 10);
+  it2 = b.insert(it2, 10);
+  ASSERT_EQ(*it1, 10);
+  ExpectEqual(a, b);
+  it1 = a.erase(it1);
+  it2 = b.erase(it2);
+  ASSERT_EQ(*it1, *it2);
+  ExpectEqual(a, b);
+}
+
+TEST(test_unrolled_list, InsertShiftsShorterSide) {
+  mynamespace::UnrolledList<CountedMoves, 8> a;
+  for (int i = 0; i < 8; ++i) a.emplace_back(i);
+  a.pop_front();
+  a.pop_front();
+  a.pop_back();
+  auto it = a.begin();
+  ++it;
+  CountedMoves::moves = 0;
+  it = a.emplace(it, 42);
+  ASSERT_EQ((*it).value, 42);
+  ASSERT_EQ(CountedMoves::moves, 2);
+  std::vector<int> values;
+  for (it = a.begin(); it != a.end(); ++it) values.push_back((*it).value);
+  ASSERT_EQ(values, std::vector<int>({2, 42, 3, 4, 5, 6}));
+}
+
+TEST(test_unrolled_list, EraseMergesChunks) {
+  mynamespace::UnrolledList<int, 4> a;
+  std::list<int> b;
+  for (int i = 1; i <= 16; ++i) {
+    a.push_back(i);
+    if (i % 4 == 0) b.push_back(i);
+  }
+  ASSERT_EQ(CountChunks(a), 4U);
+  for (auto it = a.begin(); it != a.end();) {
+    if (*it % 4 != 0) {
+      it = a.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ExpectEqual(a, b);
+  ASSERT_EQ(CountChunks(a), 1U);
+}
+
+TEST(test_unrolled_list, RandomOperations) {
+  mynamespace::UnrolledList<int, 4> a;
+  std::list<int> b;
+  std::mt19937 gen(7);
+  for (int step = 0; step < 5000; ++step) {
+    size_t index = b.empty() ? 0 : gen() % (b.size() + 1);
+    auto it1 = a.begin();
+    auto it2 = b.begin();
+    for (size_t i = 0; i < index; ++i, ++it1, ++it2) {
+    }
+    if (gen() % 3 != 0 || b.empty() || it2 == b.end()) {
+      int value = static_cast<int>(gen() % 1000);
+      ASSERT_EQ(*a.insert(it1, value), *b.insert(it2, value));
+    } else {
+      auto next1 = a.erase(it1);
+      auto next2 = b.erase(it2);
+      ASSERT_EQ(next1 == a.end(), next2 == b.end());
+      if (next2 != b.end()) {
+        ASSERT_EQ(*next1, *next2);
+      }
+    }
+  }
+  ExpectEqual(a, b);
+}
+
+TEST(test_unrolled_list, Emplace) {
+  mynamespace::UnrolledList<std::pair<int, std::string>, 4> a;
+  a.emplace_back(2, "b");
+  a.emplace_front(1, "a");
+  a.emplace(a.cend(), 3, "c");
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a.front().second, "a");
+  ASSERT_EQ(a.back().first, 3);
+}
+
+TEST(test_unrolled_list, SortUniqueReverse) {
+  mynamespace::UnrolledList<int, 4> a{5, 3, 3, 8, 1, 9, 2, 7, 3, 3, 0, 0};
+  std::list<int> b{5, 3, 3, 8, 1, 9, 2, 7, 3, 3, 0, 0};
+  a.sort();
+  b.sort();
+  ExpectEqual(a, b);
+  a.unique();
+  b.unique();
+  ExpectEqual(a, b);
+  a.reverse();
+  b.reverse();
+  ExpectEqual(a, b);
+  a.sort(std::greater<int>());
+  b.sort(std::greater<int>());
+  ExpectEqual(a, b);
+}
+
+TEST(test_unrolled_list, MergeSplice) {
+  mynamespace::UnrolledList<int, 4> a{1, 3, 5, 7, 9};
+  mynamespace::UnrolledList<int, 4> b{2, 4, 6, 8, 10, 12};
+  std::list<int> c{1, 3, 5, 7, 9};
+  std::list<int> d{2, 4, 6, 8, 10, 12};
+  a.merge(b);
+  c.merge(d);
+  ASSERT_TRUE(b.empty());
+  ExpectEqual(a, c);
+  mynamespace::UnrolledList<int, 4> e{100, 200, 300};
+  std::list<int> f{100, 200, 300};
+  auto it1 = a.cbegin();
+  auto it2 = c.cbegin();
+  for (int i = 0; i < 5; ++i, ++it1, ++it2) {
+  }
+  a.splice(it1, e);
+  c.splice(it2, f);
+  ASSERT_TRUE(e.empty());
+  ExpectEqual(a, c);
+  mynamespace::UnrolledList<int, 4> g{-1};
+  a.splice(a.cend(), g);
+  c.push_back(-1);
+  ExpectEqual(a, c);
+}
+
+TEST(test_unrolled_list, InsertMany) {
+  mynamespace::UnrolledList<int, 4> a{1, 2, 3, 4, 5, 6};
+  std::list<int> b{1, 2, 3, 4, 5, 6};
+  auto it1 = a.cbegin();
+  ++it1;
+  auto it2 = b.cbegin();
+  ++it2;
+  auto pos = a.insert_many(it1, 10, 20, 30, 40, 50);
+  b.insert(it2, {10, 20, 30, 40, 50});
+  ASSERT_EQ(*pos, 2);
+  a.insert_many_back(60, 70);
+  b.insert(b.end(), {60, 70});
+  a.insert_many_front(80, 90);
+  b.insert(b.begin(), {80, 90});
+  ExpectEqual(a, b);
+}
+
+TEST(test_unrolled_list, QueueStackBackend) {
+  mynamespace::Queue<int, mynamespace::UnrolledList<int, 4>> a{1, 2, 3};
+  mynamespace::Stack<int, mynamespace::UnrolledList<int, 4>> b{1, 2, 3};
+  for (int i = 4; i < 20; ++i) {
+    a.push(i);
+    b.push(i);
+  }
+  a.insert_many_back(20, 21);
+  b.insert_many_front(20, 21);
+  for (int i = 1; i < 22; ++i) {
+    ASSERT_EQ(a.front(), i);
+    ASSERT_EQ(b.top(), 22 - i);
+    a.pop();
+    b.pop();
+  }
+  ASSERT_TRUE(a.empty());
+  ASSERT_TRUE(b.empty());
+}
@@ -0,0 +1,25 @@
+#ifndef SRC_TEST_VALUES_H_
+#define SRC_TEST_VALUES_H_
+
+#include <string>
+#include <utility>
+
+// Element types shared by the container tests.
+
+// Counts its copies and moves, to check that push and emplace move an element
+// into the container instead of copying it.
+struct Message {
+  inline static int copies = 0;
+  inline static int moves = 0;
+  std::string body;
+  int id;
+  Message(std::string b, int i) : body(std::move(b)), id(i) {}
+  Message(const Message &other) : body(other.body), id(other.id) { ++copies; }
+  Message(Message &&other) noexcept
+      : body(std::move(other.body)), id(other.id) {
+    ++moves;
+  }
+  static void reset() { copies = moves = 0; }
+};
+
+#endif  // SRC_TEST_VALUES_H_
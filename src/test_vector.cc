@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "my_stack.h"
+#include "my_vector.h"
+
+namespace {
+
+struct Tracked {
+  static int live;
+  static int copies;
+  std::string value;
+  Tracked(std::string v = "") : value(std::move(v)) { ++live; }
+  Tracked(const Tracked &other) : value(other.value) {
+    ++live;
+    ++copies;
+  }
+  Tracked(Tracked &&other) noexcept : value(std::move(other.value)) { ++live; }
+  Tracked &operator=(const Tracked &other) = default;
+  Tracked &operator=(Tracked &&other) noexcept = default;
+  ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+int Tracked::copies = 0;
+
+}  // namespace
+
+TEST(test_vector, Constructors) {
+  mynamespace::Vector<int> a;
+  std::vector<int> b;
+  ASSERT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  mynamespace::Vector<std::string> c(3);
+  ASSERT_EQ(c.size(), 3U);
+  mynamespace::Vector<std::string> d{"Misha", "Max", "Sasha"};
+  mynamespace::Vector<std::string> e(d);
+  mynamespace::Vector<std::string> f(std::move(d));
+  ASSERT_TRUE(d.empty());
+  ASSERT_EQ(e.size(), 3U);
+  ASSERT_EQ(f[1], "Max");
+  ASSERT_EQ(e.back(), "Sasha");
+  d = std::move(f);
+  ASSERT_EQ(d.front(), "Misha");
+}
+
+TEST(test_vector, ElementAccess) {
+  mynamespace::Vector<int> a{1, 2, 3};
+  ASSERT_EQ(a.at(0), 1);
+  ASSERT_EQ(a[2], 3);
+  ASSERT_EQ(*a.data(), 1);
+  a[1] = 5;
+  ASSERT_EQ(a.at(1), 5);
+  ASSERT_THROW(a.at(3), std::out_of_range);
+}
+
+TEST(test_vector, GeometricGrowth) {
+  mynamespace::Vector<int> a;
+  size_t reallocations = 0;
+  size_t capacity = a.capacity();
+  for (int i = 0; i < 100000; ++i) {
+    a.push_back(i);
+    if (a.capacity() != capacity) {
+      ++reallocations;
+      capacity = a.capacity();
+    }
+  }
+  ASSERT_LE(reallocations, 20U);
+  for (int i = 0; i < 100000; ++i) ASSERT_EQ(a[i], i);
+}
+
+TEST(test_vector, ReserveShrink) {
+  mynamespace::Vector<std::string> a{"a", "b"};
+  a.reserve(100);
+  ASSERT_EQ(a.capacity(), 100U);
+  ASSERT_EQ(a.size(), 2U);
+  a.reserve(10);
+  ASSERT_EQ(a.capacity(), 100U);
+  a.shrink_to_fit();
+  ASSERT_EQ(a.capacity(), 2U);
+  ASSERT_EQ(a[0], "a");
+  ASSERT_EQ(a[1], "b");
+  a.clear();
+  a.shrink_to_fit();
+  ASSERT_EQ(a.capacity(), 0U);
+  ASSERT_THROW(a.reserve(a.max_size() + 1), std::length_error);
+}
+
+TEST(test_vector, MoveAwareReallocation) {
+  Tracked::copies = 0;
+  {
+    mynamespace::Vector<Tracked> a;
+    for (int i = 0; i < 1000; ++i) a.emplace_back(std::to_string(i));
+    a.shrink_to_fit();
+    ASSERT_EQ(Tracked::copies, 0);
+    ASSERT_EQ(Tracked::live, 1000);
+    ASSERT_EQ(a[999].value, "999");
+  }
+  ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST(test_vector, SelfReferencePush) {
+  mynamespace::Vector<std::string> a{"first"};
+  for (int i = 0; i < 10; ++i) a.push_back(a[0]);
+  ASSERT_EQ(a.size(), 11U);
+  ASSERT_EQ(a.back(), "first");
+}
+
+TEST(test_vector, InsertErase) {
+  mynamespace::Vector<int> a{1, 2, 3, 4};
+  std::vector<int> b{1, 2, 3, 4};
+  a.insert(a.begin() + 1, 10);
+  b.insert(b.begin() + 1, 10);
+  a.insert(a.end(), 20);
+  b.insert(b.end(), 20);
+  a.erase(a.begin());
+  b.erase(b.begin());
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < b.size(); ++i) ASSERT_EQ(a[i], b[i]);
+}
+
+TEST(test_vector, InsertMany) {
+  mynamespace::Vector<int> a{1, 2, 3};
+  std::vector<int> b{1, 2, 3};
+  auto it = a.insert_many(a.cbegin() + 1, 10, 20, 30);
+  b.insert(b.begin() + 1, {10, 20, 30});
+  ASSERT_EQ(*it, 2);
+  a.insert_many_back(40, 50);
+  b.insert(b.end(), {40, 50});
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < b.size(); ++i) ASSERT_EQ(a[i], b[i]);
+}
+
+TEST(test_vector, InsertManyAliasing) {
+  mynamespace::Vector<std::string> a{"first", "second"};
+  a.shrink_to_fit();
+  a.insert_many_back(a[0], a[1]);
+  a.shrink_to_fit();
+  a.insert_many(a.cbegin() + 1, a[3], a[0]);
+  std::vector<std::string> b{"first", "second", "first",
+                             "second", "first", "second"};
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < b.size(); ++i) ASSERT_EQ(a[i], b[i]);
+}
+
+TEST(test_vector, PopSwap) {
+  mynamespace::Vector<int> a{1, 2, 3};
+  mynamespace::Vector<int> b{4};
+  a.pop_back();
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1U);
+  ASSERT_EQ(b.size(), 2U);
+  ASSERT_EQ(b.back(), 2);
+}
+
+TEST(test_vector, StackBackend) {
+  mynamespace::Stack<int> a;
+  for (int i = 0; i < 100; ++i) a.push(i);
+  for (int i = 0; i < 50; ++i) a.pop();
+  for (int i = 0; i < 50; ++i) a.push(i);
+  ASSERT_EQ(a.size(), 100U);
+  ASSERT_EQ(a.top(), 49);
+  mynamespace::Stack<int, mynamespace::List<int>> b{1, 2, 3};
+  ASSERT_EQ(b.top(), 3);
+}
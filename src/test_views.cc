@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "my_list.h"
+#include "my_queue.h"
+#include "my_stack.h"
+#include "my_vector.h"
+#include "my_views.h"
+
+namespace views = mynamespace::views;
+
+namespace {
+
+template <class View>
+std::vector<typename std::iterator_traits<
+    decltype(std::declval<const View &>().begin())>::value_type>
+Collect(const View &view) {
+  return {view.begin(), view.end()};
+}
+
+mynamespace::List<int> Numbers(int n) {
+  mynamespace::List<int> list;
+  for (int i = 1; i <= n; ++i) list.push_back(i);
+  return list;
+}
+
+}  // namespace
+
+TEST(test_views, FilterTransformTake) {
+  mynamespace::List<int> a = Numbers(20);
+  int calls = 0;
+  auto squares = a | views::filter([](int x) { return x % 3 == 0; }) |
+                 views::transform([&calls](int x) {
+                   ++calls;
+                   return x * x;
+                 }) |
+                 views::take(4);
+  ASSERT_EQ(calls, 0);
+  ASSERT_EQ(Collect(squares), (std::vector<int>{9, 36, 81, 144}));
+  ASSERT_EQ(calls, 4);
+  ASSERT_EQ((a | views::transform([](int x) { return x; }) | views::take(4))
+                .size(),
+            4U);
+  int tested = 0;
+  auto counted = [&tested](int x) {
+    ++tested;
+    return x % 2 == 0;
+  };
+  std::vector<int> taken;
+  for (int x : a | views::filter(counted) | views::take(3)) taken.push_back(x);
+  ASSERT_EQ(taken, (std::vector<int>{2, 4, 6}));
+  ASSERT_EQ(tested, 6);
+  auto none = a | views::filter([](int x) { return x > 100; });
+  ASSERT_EQ(none.begin(), none.end());
+  ASSERT_EQ(Collect(a | views::take(100)).size(), 20U);
+  ASSERT_EQ(Collect(a | views::take(0)).size(), 0U);
+}
+
+TEST(test_views, IteratorEquality) {
+  mynamespace::List<int> a = Numbers(5);
+  auto three = a | views::take(3);
+  auto last = three.begin();
+  ++last;
+  ++last;
+  auto past = last;
+  ++past;
+  ASSERT_NE(last, past);
+  ASSERT_NE(last, three.end());
+  ASSERT_EQ(past, three.end());
+  auto all = a | views::take(10);
+  auto it = all.begin();
+  for (int i = 0; i < 5; ++i, ++it) ASSERT_NE(it, all.end());
+  ASSERT_EQ(it, all.end());
+  mynamespace::List<int> b = Numbers(2);
+  auto zip = a | views::zip(b);
+  auto z1 = zip.begin();
+  auto z2 = z1;
+  ++z2;
+  ASSERT_NE(z1, z2);
+  ++z1;
+  ASSERT_EQ(z1, z2);
+  ++z2;
+  ASSERT_NE(z1, z2);
+  ASSERT_EQ(z2, zip.end());
+  ASSERT_EQ(zip.end(), z2);
+}
+
+TEST(test_views, DropReverseAndWrite) {
+  mynamespace::List<int> a = Numbers(6);
+  ASSERT_EQ(Collect(a | views::drop(4)), (std::vector<int>{5, 6}));
+  ASSERT_EQ((a | views::drop(10)).size(), 0U);
+  ASSERT_EQ(Collect(a | views::reverse() | views::drop(1) | views::take(2)),
+            (std::vector<int>{5, 4}));
+  auto odd = [](int x) { return x % 2 == 1; };
+  ASSERT_EQ(Collect(a | views::filter(odd) | views::reverse()),
+            (std::vector<int>{5, 3, 1}));
+  ASSERT_EQ(Collect(a | views::transform([](int x) { return -x; }) |
+                    views::reverse() | views::take(2)),
+            (std::vector<int>{-6, -5}));
+  for (int &x : a | views::filter(odd)) x *= 10;
+  ASSERT_EQ(Collect(views::all(a)), (std::vector<int>{10, 2, 30, 4, 50, 6}));
+  const mynamespace::List<int> &view = a;
+  auto it = (view | views::take(1)).begin();
+  static_assert(std::is_same_v<decltype(*it), const int &>);
+  ASSERT_EQ(*it, 10);
+}
+
+TEST(test_views, ZipAndChunk) {
+  mynamespace::List<int> a = Numbers(5);
+  mynamespace::List<std::string> names{"one", "two", "three"};
+  std::vector<std::pair<int, std::string>> zipped;
+  for (auto [number, name] : a | views::zip(names)) {
+    zipped.emplace_back(number, name);
+  }
+  ASSERT_EQ(zipped.size(), 3U);
+  ASSERT_EQ(zipped[2], std::make_pair(3, std::string("three")));
+  ASSERT_EQ((a | views::zip(names)).size(), 3U);
+  for (auto [number, name] : a | views::zip(names)) name += "!";
+  ASSERT_EQ(names.back(), "three!");
+  std::vector<int> sums;
+  for (auto chunk : a | views::chunk(2)) {
+    int sum = 0;
+    for (int x : chunk) sum += x;
+    sums.push_back(sum);
+  }
+  ASSERT_EQ(sums, (std::vector<int>{3, 7, 5}));
+  ASSERT_EQ((a | views::chunk(2)).size(), 3U);
+  ASSERT_EQ(Collect(a | views::chunk(3) | views::transform([](auto chunk) {
+                      return *chunk.begin();
+                    })),
+            (std::vector<int>{1, 4}));
+}
+
+TEST(test_views, AdaptersAndComposition) {
+  mynamespace::Queue<int> q;
+  mynamespace::Stack<int> s;
+  for (int i = 1; i <= 5; ++i) {
+    q.push(i);
+    s.push(i * 10);
+  }
+  auto evens_doubled = views::filter([](int x) { return x % 2 == 0; }) |
+                       views::transform([](int x) { return x * 2; });
+  ASSERT_EQ(Collect(q | evens_doubled), (std::vector<int>{4, 8}));
+  ASSERT_EQ(Collect(s | views::reverse() | views::take(2)),
+            (std::vector<int>{50, 40}));
+  ASSERT_EQ(Collect(Numbers(4) | evens_doubled), (std::vector<int>{4, 8}));
+}
+
+TEST(test_views, Materialize) {
+  mynamespace::List<int> a = Numbers(10);
+  auto list = a | views::transform([](int x) { return x * 1.5; }) |
+              mynamespace::to<mynamespace::List>();
+  static_assert(std::is_same_v<decltype(list), mynamespace::List<double>>);
+  ASSERT_EQ(list.size(), 10U);
+  ASSERT_EQ(list.back(), 15.0);
+  auto vec = a | views::filter([](int x) { return x > 7; }) |
+             mynamespace::to<mynamespace::Vector<long>>();
+  ASSERT_EQ(vec.size(), 3U);
+  ASSERT_EQ(vec[0], 8L);
+  auto sized = a | views::drop(2) | mynamespace::to<mynamespace::Vector>();
+  ASSERT_EQ(sized.capacity(), 8U);
+  auto queue = a | views::reverse() | mynamespace::to<mynamespace::Queue>();
+  ASSERT_EQ(queue.front(), 10);
+  ASSERT_EQ(queue.back(), 1);
+  mynamespace::List<std::string> names{"a", "b"};
+  auto pairs = a | views::zip(names) | mynamespace::to<mynamespace::List>();
+  ASSERT_EQ(pairs.front(), std::make_pair(1, std::string("a")));
+}
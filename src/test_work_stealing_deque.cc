@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "my_work_stealing_deque.h"
+
+TEST(test_work_stealing_deque, OwnerAndThief) {
+  mynamespace::WorkStealingDeque<int> a(4);
+  ASSERT_TRUE(a.empty());
+  for (int i = 0; i < 10; ++i) a.push(i);
+  ASSERT_EQ(a.size(), 10U);
+  ASSERT_GE(a.capacity(), 10U);
+  int value;
+  ASSERT_TRUE(a.pop(value));
+  ASSERT_EQ(value, 9);
+  ASSERT_TRUE(a.steal(value));
+  ASSERT_EQ(value, 0);
+  ASSERT_TRUE(a.steal(value));
+  ASSERT_EQ(value, 1);
+  for (int expected = 8; expected > 1; --expected) {
+    ASSERT_TRUE(a.pop(value));
+    ASSERT_EQ(value, expected);
+  }
+  ASSERT_FALSE(a.pop(value));
+  ASSERT_FALSE(a.steal(value));
+  ASSERT_TRUE(a.empty());
+  a.push(42);
+  ASSERT_TRUE(a.pop(value));
+  ASSERT_EQ(value, 42);
+}
+
+// Every pushed item is taken exactly once, by the owner or by a thief.
+TEST(test_work_stealing_deque, StealStress) {
+  constexpr int kThieves = 3;
+  constexpr int kCount = 200000;
+  mynamespace::WorkStealingDeque<int> a(2);
+  std::vector<std::vector<int>> taken(kThieves + 1);
+  std::atomic<bool> done(false);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&a, &taken, &done, t] {
+      int value;
+      while (!done.load()) {
+        if (a.steal(value)) {
+          taken[t].push_back(value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+      while (a.steal(value)) taken[t].push_back(value);
+    });
+  }
+  int value;
+  for (int i = 0; i < kCount; ++i) {
+    a.push(i);
+    if (i % 3 == 0 && a.pop(value)) taken[kThieves].push_back(value);
+  }
+  while (a.pop(value)) taken[kThieves].push_back(value);
+  done.store(true);
+  for (auto &thief : thieves) thief.join();
+
+  std::vector<int> seen(kCount, 0);
+  for (const auto &items : taken) {
+    for (int item : items) ++seen[item];
+  }
+  for (int count : seen) ASSERT_EQ(count, 1);
+}
+
+// A pop that loses the last element to a thief reports false and leaves the
+// caller's value alone.
+TEST(test_work_stealing_deque, LostPopKeepsValue) {
+  constexpr int kRounds = 100000;
+  mynamespace::WorkStealingDeque<int> a(2);
+  std::atomic<bool> done(false);
+  std::thread thief([&a, &done] {
+    int value;
+    while (!done.load()) a.steal(value);
+  });
+  for (int i = 0; i < kRounds; ++i) {
+    a.push(i);
+    int value = -1;
+    if (!a.pop(value)) {
+      ASSERT_EQ(value, -1);
+    }
+  }
+  done.store(true);
+  thief.join();
+}